@@ -36,6 +36,24 @@ install(
    INCLUDES DESTINATION ${CMAKE_INSTALL_INCLUDEDIR}
 )
 
+# The module interface is installed as a source, the consumers build it with their own compiler settings
+if(SHP_BUILD_MODULE)
+   install(
+      TARGETS simple_hex_printer_module
+
+      EXPORT ${SHP_TARGETS_EXPORT_NAME}
+
+      ARCHIVE DESTINATION ${CMAKE_INSTALL_LIBDIR}
+              COMPONENT   SHP_Development
+
+      FILE_SET CXX_MODULES
+               DESTINATION ${CMAKE_INSTALL_INCLUDEDIR}/shp/modules
+               COMPONENT   SHP_Development
+   )
+
+   set(SHP_EXPORT_MODULE_ARGS CXX_MODULES_DIRECTORY cxx-modules)
+endif()
+
 install(DIRECTORY include/ DESTINATION ${CMAKE_INSTALL_INCLUDEDIR})
 install(DIRECTORY ${SHP_GENERATED_INCLUDE_DIR}/ DESTINATION ${CMAKE_INSTALL_INCLUDEDIR})
 install(
@@ -61,4 +79,5 @@ install(
    DESTINATION ${SHP_INSTALL_CMAKE_DIR}
    NAMESPACE ${SHP_INSTALL_NAMESPACE}
    COMPONENT SHP_Development
+   ${SHP_EXPORT_MODULE_ARGS}
 )
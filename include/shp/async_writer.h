@@ -0,0 +1,640 @@
+/**
+ * @file   async_writer.h
+ * @author Dennis Sitelew
+ * @date   Oct. 18, 2026
+ */
+#ifndef SIMPLE_HEX_PRINTER_INCLUDE_SHP_ASYNC_WRITER_H
+#define SIMPLE_HEX_PRINTER_INCLUDE_SHP_ASYNC_WRITER_H
+
+#include <shp/core.h>
+
+#if defined(_WIN32)
+#error "shp/async_writer.h requires a POSIX system"
+#endif
+
+#include <cerrno>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/types.h>
+#include <unistd.h>
+
+#if defined(__linux__) && defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#define SHP_HAS_IO_URING 1
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#endif
+#endif
+
+namespace shp {
+
+//! Backend, used for writing the formatted data
+enum class async_backend {
+   automatic, //!< io_uring if supported by the system, a writer thread otherwise
+   io_uring,  //!< Linux io_uring
+   thread,    //!< A writer thread, calling pwrite()
+};
+
+namespace detail {
+
+[[noreturn]] inline void throw_errno(int error, const char *what) {
+   throw std::system_error{error, std::generic_category(), what};
+}
+
+//! Result of a single buffer write
+struct write_completion {
+   std::size_t id; //!< Buffer identifier, passed to write_backend::submit()
+   int error;      //!< errno value of a failed write, zero on success
+};
+
+//! Common interface of the asynchronous write backends
+class write_backend {
+public:
+   virtual ~write_backend() = default;
+
+   /**
+    * Start writing a buffer.
+    * @param id Buffer identifier, returned by wait_one() once the buffer is written or the write has failed
+    * @param data Buffer data, should stay valid until the write is complete
+    * @param size Number of bytes to write
+    * @param offset File offset
+    */
+   virtual void submit(std::size_t id, const char *data, std::size_t size, std::uint64_t offset) = 0;
+
+   /**
+    * Wait for a submitted buffer to be written. Write errors are reported in the result, so that the buffer can be
+    * reused, exceptions mean that no buffer has completed.
+    * @return The buffer identifier and the write error
+    */
+   virtual write_completion wait_one() = 0;
+};
+
+//! Writes buffers with pwrite() calls from a dedicated thread
+class thread_backend : public write_backend {
+private:
+   struct request {
+      std::size_t id;
+      const char *data;
+      std::size_t size;
+      std::uint64_t offset;
+   };
+
+public:
+   explicit thread_backend(int fd)
+      : fd_{fd}
+      , thread_{[this] { run(); }} {
+      // Nothing to do here
+   }
+
+   ~thread_backend() override {
+      {
+         std::lock_guard<std::mutex> lock{mutex_};
+         stop_ = true;
+      }
+      requests_cv_.notify_one();
+      thread_.join();
+   }
+
+public:
+   void submit(std::size_t id, const char *data, std::size_t size, std::uint64_t offset) override {
+      {
+         std::lock_guard<std::mutex> lock{mutex_};
+         requests_.push_back({id, data, size, offset});
+      }
+      requests_cv_.notify_one();
+   }
+
+   write_completion wait_one() override {
+      std::unique_lock<std::mutex> lock{mutex_};
+      completions_cv_.wait(lock, [this] { return !completions_.empty(); });
+
+      const auto result = completions_.front();
+      completions_.pop_front();
+      return result;
+   }
+
+private:
+   int write_all(request r) const {
+      while (r.size != 0) {
+         const auto count = ::pwrite(fd_, r.data, r.size, static_cast<off_t>(r.offset));
+         if (count < 0) {
+            if (errno == EINTR) {
+               continue;
+            }
+            return errno;
+         }
+         r.data += count;
+         r.size -= static_cast<std::size_t>(count);
+         r.offset += static_cast<std::uint64_t>(count);
+      }
+      return 0;
+   }
+
+   void run() {
+      std::unique_lock<std::mutex> lock{mutex_};
+      for (;;) {
+         requests_cv_.wait(lock, [this] { return stop_ || !requests_.empty(); });
+         if (requests_.empty()) {
+            return;
+         }
+
+         const auto r = requests_.front();
+         requests_.pop_front();
+
+         lock.unlock();
+         const auto error = write_all(r);
+         lock.lock();
+
+         completions_.push_back({r.id, error});
+         completions_cv_.notify_one();
+      }
+   }
+
+private:
+   int fd_;
+
+   std::mutex mutex_;
+   std::condition_variable requests_cv_;
+   std::condition_variable completions_cv_;
+   std::deque<request> requests_;
+   std::deque<write_completion> completions_;
+   bool stop_{false};
+
+   //! Should be the last member, so that the thread starts with everything else initialized
+   std::thread thread_;
+};
+
+#if defined(SHP_HAS_IO_URING)
+
+//! Writes buffers with io_uring, using the raw system calls
+class io_uring_backend : public write_backend {
+private:
+   struct request {
+      const char *data;
+      std::size_t size;
+      std::uint64_t offset;
+   };
+
+public:
+   io_uring_backend(int fd, std::size_t max_requests)
+      : fd_{fd}
+      , requests_(max_requests) {
+      io_uring_params params{};
+      ring_fd_ = static_cast<int>(::syscall(__NR_io_uring_setup, static_cast<unsigned>(max_requests), &params));
+      if (ring_fd_ < 0) {
+         throw_errno(errno, "Error creating io_uring");
+      }
+
+      try {
+         map_rings(params);
+         check_write_support();
+      } catch (...) {
+         unmap_rings();
+         ::close(ring_fd_);
+         throw;
+      }
+   }
+
+   ~io_uring_backend() override {
+      unmap_rings();
+      ::close(ring_fd_);
+   }
+
+   io_uring_backend(const io_uring_backend &) = delete;
+   io_uring_backend &operator=(const io_uring_backend &) = delete;
+
+public:
+   void submit(std::size_t id, const char *data, std::size_t size, std::uint64_t offset) override {
+      requests_[id] = {data, size, offset};
+      push(id);
+   }
+
+   write_completion wait_one() override {
+      for (;;) {
+         const auto head = *cq_head_;
+         if (head == __atomic_load_n(cq_tail_, __ATOMIC_ACQUIRE)) {
+            enter(0, 1, IORING_ENTER_GETEVENTS);
+            continue;
+         }
+
+         const auto &cqe = cqes_[head & *cq_mask_];
+         const auto id = static_cast<std::size_t>(cqe.user_data);
+         const auto res = cqe.res;
+         __atomic_store_n(cq_head_, head + 1, __ATOMIC_RELEASE);
+
+         if (res < 0) {
+            if (res == -EINTR || res == -EAGAIN) {
+               push(id);
+               continue;
+            }
+            return {id, -res};
+         }
+
+         // Partial writes are resubmitted until the whole buffer is written
+         auto &r = requests_[id];
+         const auto count = static_cast<std::size_t>(res);
+         if (count < r.size) {
+            if (count == 0) {
+               return {id, EIO};
+            }
+            r.data += count;
+            r.size -= count;
+            r.offset += count;
+            push(id);
+            continue;
+         }
+         return {id, 0};
+      }
+   }
+
+private:
+   //! IORING_OP_WRITE needs Linux 5.6, older kernels create the ring, but fail every write with -EINVAL
+   void check_write_support() const {
+      constexpr std::size_t ops = IORING_OP_WRITE + 1;
+      constexpr std::size_t probe_size = sizeof(io_uring_probe) + ops * sizeof(io_uring_probe_op);
+
+      // The probe should be zero-initialized, the kernel fills in the supported operations
+      std::vector<std::uint64_t> storage((probe_size + sizeof(std::uint64_t) - 1) / sizeof(std::uint64_t));
+      auto probe = reinterpret_cast<io_uring_probe *>(storage.data());
+
+      // Probing was added in the same kernel version as IORING_OP_WRITE
+      const bool probed = ::syscall(__NR_io_uring_register, ring_fd_, IORING_REGISTER_PROBE, probe, ops) >= 0;
+      if (!probed || probe->last_op < IORING_OP_WRITE
+          || (probe->ops[IORING_OP_WRITE].flags & IO_URING_OP_SUPPORTED) == 0) {
+         throw std::system_error{std::make_error_code(std::errc::function_not_supported),
+                                 "io_uring doesn't support writes"};
+      }
+   }
+
+   void map_rings(const io_uring_params &params) {
+      sq_size_ = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+      cq_size_ = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+
+      const bool single_mmap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+      if (single_mmap) {
+         sq_size_ = cq_size_ = sq_size_ > cq_size_ ? sq_size_ : cq_size_;
+      }
+
+      sq_ring_ = map(sq_size_, IORING_OFF_SQ_RING);
+      cq_ring_ = single_mmap ? sq_ring_ : map(cq_size_, IORING_OFF_CQ_RING);
+
+      sqes_size_ = params.sq_entries * sizeof(io_uring_sqe);
+      sqes_ = static_cast<io_uring_sqe *>(map(sqes_size_, IORING_OFF_SQES));
+
+      auto sq = static_cast<char *>(sq_ring_);
+      sq_tail_ = reinterpret_cast<unsigned *>(sq + params.sq_off.tail);
+      sq_mask_ = reinterpret_cast<unsigned *>(sq + params.sq_off.ring_mask);
+      sq_array_ = reinterpret_cast<unsigned *>(sq + params.sq_off.array);
+
+      auto cq = static_cast<char *>(cq_ring_);
+      cq_head_ = reinterpret_cast<unsigned *>(cq + params.cq_off.head);
+      cq_tail_ = reinterpret_cast<unsigned *>(cq + params.cq_off.tail);
+      cq_mask_ = reinterpret_cast<unsigned *>(cq + params.cq_off.ring_mask);
+      cqes_ = reinterpret_cast<io_uring_cqe *>(cq + params.cq_off.cqes);
+   }
+
+   void *map(std::size_t size, off_t offset) const {
+      auto result = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd_, offset);
+      if (result == MAP_FAILED) {
+         throw_errno(errno, "Error mapping io_uring");
+      }
+      return result;
+   }
+
+   void unmap_rings() {
+      if (sqes_ != nullptr) {
+         ::munmap(sqes_, sqes_size_);
+      }
+      if (cq_ring_ != nullptr && cq_ring_ != sq_ring_) {
+         ::munmap(cq_ring_, cq_size_);
+      }
+      if (sq_ring_ != nullptr) {
+         ::munmap(sq_ring_, sq_size_);
+      }
+   }
+
+   void push(std::size_t id) {
+      const auto &r = requests_[id];
+
+      // Only this thread submits, so the tail can be read without synchronization
+      const auto tail = *sq_tail_;
+      const auto index = tail & *sq_mask_;
+
+      auto &sqe = sqes_[index];
+      std::memset(&sqe, 0, sizeof(sqe));
+      sqe.opcode = IORING_OP_WRITE;
+      sqe.fd = fd_;
+      sqe.addr = reinterpret_cast<std::uint64_t>(r.data);
+      sqe.len = static_cast<std::uint32_t>(r.size);
+      sqe.off = r.offset;
+      sqe.user_data = id;
+
+      sq_array_[index] = index;
+      __atomic_store_n(sq_tail_, tail + 1, __ATOMIC_RELEASE);
+
+      enter(1, 0, 0);
+   }
+
+   void enter(unsigned to_submit, unsigned min_complete, unsigned flags) const {
+      for (;;) {
+         const auto res = ::syscall(__NR_io_uring_enter, ring_fd_, to_submit, min_complete, flags, nullptr, 0);
+         if (res >= 0) {
+            return;
+         }
+         if (errno != EINTR) {
+            throw_errno(errno, "Error submitting to io_uring");
+         }
+      }
+   }
+
+private:
+   int fd_;
+   int ring_fd_{-1};
+   std::vector<request> requests_;
+
+   void *sq_ring_{nullptr};
+   void *cq_ring_{nullptr};
+   std::size_t sq_size_{0};
+   std::size_t cq_size_{0};
+
+   io_uring_sqe *sqes_{nullptr};
+   std::size_t sqes_size_{0};
+
+   unsigned *sq_tail_{nullptr};
+   unsigned *sq_mask_{nullptr};
+   unsigned *sq_array_{nullptr};
+
+   unsigned *cq_head_{nullptr};
+   unsigned *cq_tail_{nullptr};
+   unsigned *cq_mask_{nullptr};
+   io_uring_cqe *cqes_{nullptr};
+};
+
+#endif // SHP_HAS_IO_URING
+
+} // namespace detail
+
+//! Options of the asynchronous file writer
+struct async_writer_options {
+   //! Size of a single buffer, less than 4 GiB, so that a buffer can be written with a single io_uring request
+   std::size_t buffer_size{4U << 20U};
+
+   //! Number of buffers, at least 2
+   std::size_t buffer_count{2};
+
+   //! Write backend
+   async_backend backend{async_backend::automatic};
+};
+
+////////////////////////////////////////////////////////////////////////////////
+/// Class: async_file_writer
+////////////////////////////////////////////////////////////////////////////////
+/**
+ * Sink, writing the formatted output into a file asynchronously.
+ *
+ * The output is collected in one buffer while the previously filled buffers are being written, so formatting and I/O
+ * overlap. The memory usage is bounded by the buffer count: once all buffers are in flight, the formatting waits for
+ * the oldest write to complete.
+ *
+ * @example shp::async_file_writer out{"dump.txt"}; shp::hex(data).print_to(out); out.close();
+ */
+class async_file_writer {
+public:
+   using options = async_writer_options;
+
+public:
+   /**
+    * Constructor - creates (or truncates) the output file
+    * @param path Output file path
+    * @param opts Writer options, throws std::invalid_argument for a buffer size of 4 GiB or more
+    */
+   explicit async_file_writer(const std::string &path, options opts = options{})
+      : async_file_writer{path, opts, [this, &opts](int, std::size_t count) {
+         return make_backend(opts.backend, count);
+      }} {
+      // Nothing to do here
+   }
+
+   /**
+    * Constructor with a custom write backend, e.g. for testing the error handling
+    * @param path Output file path
+    * @param opts Writer options, the backend option is ignored
+    * @param make_backend Factory, called with the file descriptor and the buffer count, should return a
+    *                     std::unique_ptr<detail::write_backend>
+    */
+   template <typename BackendFactory>
+   async_file_writer(const std::string &path, options opts, BackendFactory make_backend)
+      : buffer_size_{opts.buffer_size < detail::max_acquire_size ? detail::max_acquire_size : opts.buffer_size} {
+      if (buffer_size_ > std::numeric_limits<std::uint32_t>::max()) {
+         throw std::invalid_argument{"Buffer size of the asynchronous writer should be less than 4 GiB"};
+      }
+
+      fd_ = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+      if (fd_ < 0) {
+         detail::throw_errno(errno, "Error opening dump file");
+      }
+
+      try {
+         const auto count = opts.buffer_count < 2 ? 2 : opts.buffer_count;
+         for (std::size_t i = 0; i < count; ++i) {
+            buffers_.emplace_back(new char[buffer_size_]);
+            free_.push_back(i);
+         }
+         backend_ = make_backend(fd_, count);
+      } catch (...) {
+         ::close(fd_);
+         throw;
+      }
+
+      next_buffer();
+   }
+
+   //! Destructor - writes out the remaining data, errors are ignored, use close() to get them reported
+   ~async_file_writer() {
+      try {
+         close();
+      } catch (...) {
+         // Nothing to do here
+      }
+   }
+
+   async_file_writer(const async_file_writer &) = delete;
+   async_file_writer &operator=(const async_file_writer &) = delete;
+
+public:
+   void put(char c) {
+      if (current_ == nullptr || used_ == buffer_size_) {
+         submit();
+      }
+      current_[used_++] = c;
+   }
+
+   void write(const char *data, std::size_t size) {
+      while (size != 0) {
+         if (current_ == nullptr || used_ == buffer_size_) {
+            submit();
+         }
+
+         const auto count = size < buffer_size_ - used_ ? size : buffer_size_ - used_;
+         std::memcpy(current_ + used_, data, count);
+         used_ += count;
+         data += count;
+         size -= count;
+      }
+   }
+
+   char *acquire(std::size_t size) {
+      if (current_ == nullptr || size > buffer_size_ - used_) {
+         submit();
+      }
+      return current_ + used_;
+   }
+
+   void commit(char *end) { used_ = static_cast<std::size_t>(end - current_); }
+
+   //! Write out all the collected data and wait for the writes to complete
+   void flush() {
+      submit();
+      while (in_flight_ != 0) {
+         complete_one();
+      }
+   }
+
+   //! Flush the data and close the file, errors are reported as std::system_error exceptions
+   void close() {
+      if (fd_ < 0) {
+         return;
+      }
+
+      try {
+         flush();
+      } catch (...) {
+         drain();
+         close_file();
+         throw;
+      }
+      close_file();
+   }
+
+   //! Backend in use
+   async_backend backend() const { return backend_type_; }
+
+   //! Number of bytes passed to the file so far
+   std::uint64_t bytes_written() const { return file_offset_ + used_; }
+
+private:
+   std::unique_ptr<detail::write_backend> make_backend(async_backend type, std::size_t count) {
+#if defined(SHP_HAS_IO_URING)
+      if (type != async_backend::thread) {
+         try {
+            std::unique_ptr<detail::write_backend> result{new detail::io_uring_backend{fd_, count}};
+            backend_type_ = async_backend::io_uring;
+            return result;
+         } catch (const std::system_error &) {
+            if (type == async_backend::io_uring) {
+               throw;
+            }
+         }
+      }
+#else
+      (void)count;
+      if (type == async_backend::io_uring) {
+         throw std::system_error{std::make_error_code(std::errc::function_not_supported), "io_uring is not supported"};
+      }
+#endif
+      backend_type_ = async_backend::thread;
+      return std::unique_ptr<detail::write_backend>{new detail::thread_backend{fd_}};
+   }
+
+   void next_buffer() {
+      if (free_.empty()) {
+         complete_one();
+      }
+      current_id_ = free_.front();
+      free_.pop_front();
+      current_ = buffers_[current_id_].get();
+      used_ = 0;
+   }
+
+   void submit() {
+      if (used_ != 0) {
+         backend_->submit(current_id_, current_, used_, file_offset_);
+         ++in_flight_;
+         file_offset_ += used_;
+
+         // The buffer belongs to the backend now, even if waiting for the next one fails
+         current_ = nullptr;
+         used_ = 0;
+      }
+
+      if (current_ == nullptr) {
+         // Backpressure: wait for a free buffer if all of them are in flight
+         next_buffer();
+      }
+   }
+
+   //! Wait for a write to complete and recycle its buffer, write errors are thrown after the recycling
+   void complete_one() {
+      const auto result = backend_->wait_one();
+      --in_flight_;
+      free_.push_back(result.id);
+
+      if (result.error != 0) {
+         detail::throw_errno(result.error, "Error writing dump");
+      }
+   }
+
+   //! Wait for the writes in flight, ignoring write errors
+   void drain() {
+      while (in_flight_ != 0) {
+         try {
+            const auto result = backend_->wait_one();
+            --in_flight_;
+            free_.push_back(result.id);
+         } catch (...) {
+            // The backend can't report completions anymore
+            return;
+         }
+      }
+   }
+
+   void close_file() {
+      backend_.reset();
+      ::close(fd_);
+      fd_ = -1;
+   }
+
+private:
+   int fd_{-1};
+   std::size_t buffer_size_;
+
+   std::vector<std::unique_ptr<char[]>> buffers_;
+   std::deque<std::size_t> free_;
+   std::size_t in_flight_{0};
+
+   std::size_t current_id_{0};
+   char *current_{nullptr};
+   std::size_t used_{0};
+
+   std::uint64_t file_offset_{0};
+
+   std::unique_ptr<detail::write_backend> backend_;
+   async_backend backend_type_{async_backend::thread};
+};
+
+} // namespace shp
+
+#endif /* SIMPLE_HEX_PRINTER_INCLUDE_SHP_ASYNC_WRITER_H */
@@ -0,0 +1,186 @@
+/**
+ * @file   atomic_output.h
+ * @author Dennis Sitelew
+ * @date   Oct. 18, 2026
+ *
+ * Writing whole dumps or complete rows to a stream with a single call.
+ */
+#ifndef SIMPLE_HEX_PRINTER_INCLUDE_SHP_ATOMIC_OUTPUT_H
+#define SIMPLE_HEX_PRINTER_INCLUDE_SHP_ATOMIC_OUTPUT_H
+
+#include <shp/ostream.h>
+
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace shp {
+
+////////////////////////////////////////////////////////////////////////////////
+/// Atomic output
+////////////////////////////////////////////////////////////////////////////////
+namespace detail {
+
+//! Per-thread buffer for the atomic output, separate from scratch_buffer() so that both can be used at the same time
+inline std::string &atomic_buffer() {
+   static thread_local std::string buffer;
+   return buffer;
+}
+
+//! End a non-empty output with a line end, unless it already has one
+inline void terminate_line(std::string &buffer) {
+   if (!buffer.empty() && buffer.back() != '\n') {
+      buffer.push_back('\n');
+   }
+}
+
+//! Sink collecting the output in a buffer and passing complete lines to a stream, a line is never split between calls.
+class line_sink {
+public:
+   line_sink(std::ostream &os, std::string &buffer)
+      : os_{&os}
+      , buffer_{&buffer} {
+      buffer_->clear();
+   }
+
+public:
+   void put(char c) {
+      buffer_->push_back(c);
+      if (c == '\n') {
+         publish(buffer_->size());
+      }
+   }
+
+   void write(const char *data, std::size_t size) {
+      const auto offset = buffer_->size();
+      buffer_->append(data, size);
+      publish_lines(offset);
+   }
+
+   //! Get a buffer for writing up to `size` characters directly, the written characters are marked with commit()
+   char *acquire(std::size_t size) {
+      acquired_ = buffer_->size();
+      buffer_->resize(acquired_ + size);
+      return &(*buffer_)[acquired_];
+   }
+
+   //! Mark all the characters up to `end` as written
+   void commit(char *end) {
+      buffer_->resize(static_cast<std::size_t>(end - &(*buffer_)[0]));
+      publish_lines(acquired_);
+   }
+
+   //! Terminate the last incomplete line and write it out
+   void flush() {
+      terminate_line(*buffer_);
+      publish(buffer_->size());
+   }
+
+private:
+   //! Write out all complete lines, if there is a line end after `offset`
+   void publish_lines(std::size_t offset) {
+      const auto last = buffer_->rfind('\n');
+      if (last != std::string::npos && last >= offset) {
+         publish(last + 1);
+      }
+   }
+
+   void publish(std::size_t size) {
+      if (size != 0) {
+         os_->write(buffer_->data(), static_cast<std::streamsize>(size));
+         buffer_->erase(0, size);
+      }
+   }
+
+private:
+   std::ostream *os_;
+   std::string *buffer_;
+   std::size_t acquired_{0};
+};
+
+} // namespace detail
+
+////////////////////////////////////////////////////////////////////////////////
+/// Class: atomic_writer
+////////////////////////////////////////////////////////////////////////////////
+/**
+ * Wrapper around another writer, rendering the output into a per-thread buffer and passing it to the stream with a
+ * single write call, either for the whole dump or for every row. The output always ends with a line end, written with
+ * the last row, so that the output of another thread can't be appended to it.
+ *
+ * Whether the separate write calls never interleave depends on the stream buffer: std::cout and std::cerr pass every
+ * call to a single (locked) C library call, as long as the synchronization with stdio is enabled, which is the
+ * default. Other streams should be protected by their stream buffer (e.g. std::osyncstream).
+ */
+template <typename Writer, bool PerRow>
+class atomic_writer {
+public:
+   explicit atomic_writer(Writer writer)
+      : writer_{std::move(writer)} {
+      // Nothing to do here
+   }
+
+public:
+   template <typename OWriter, bool OPerRow>
+   friend std::ostream &operator<<(std::ostream &os, const atomic_writer<OWriter, OPerRow> &v);
+
+private:
+   void do_print(std::ostream &os, std::false_type) const {
+      auto &buffer = detail::atomic_buffer();
+      buffer.clear();
+      writer_.append_to(buffer);
+      detail::terminate_line(buffer);
+      os.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+   }
+
+   void do_print(std::ostream &os, std::true_type) const {
+      detail::line_sink sink{os, detail::atomic_buffer()};
+      writer_.print_to(sink);
+      sink.flush();
+   }
+
+private:
+   Writer writer_;
+};
+
+template <typename Writer, bool PerRow>
+std::ostream &operator<<(std::ostream &os, const atomic_writer<Writer, PerRow> &v) {
+   v.do_print(os, std::integral_constant<bool, PerRow>{});
+   return os;
+}
+
+/**
+ * Construct a streamable object, writing the whole output of another writer to a stream with a single call.
+ * A line end is added to the output, unless it already ends with one, so no std::endl is required.
+ * The per-thread buffer keeps its capacity, so the memory usage is bounded by the largest dump of the thread.
+ *
+ * @example std::cout << shp::atomic_dump(shp::hex(buffer));
+ *
+ * @param writer Any of the library writers.
+ * @return A streamable object.
+ */
+template <typename Writer>
+inline atomic_writer<Writer, false> atomic_dump(Writer writer) {
+   return atomic_writer<Writer, false>{std::move(writer)};
+}
+
+/**
+ * Construct a streamable object, writing the rows of a multi-row writer to a stream as soon as they are complete.
+ * Every write call contains one or more complete rows, including their line ends, so rows of the concurrent dumps
+ * may alternate, but a row is never split.
+ *
+ * @example std::cout << shp::atomic_rows(shp::hex(buffer));
+ *
+ * @param writer Any of the library writers, printing into a sink.
+ * @return A streamable object.
+ */
+template <typename Writer>
+inline atomic_writer<Writer, true> atomic_rows(Writer writer) {
+   return atomic_writer<Writer, true>{std::move(writer)};
+}
+
+} // namespace shp
+
+#endif /* SIMPLE_HEX_PRINTER_INCLUDE_SHP_ATOMIC_OUTPUT_H */
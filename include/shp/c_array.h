@@ -0,0 +1,315 @@
+/**
+ * @file   c_array.h
+ * @author Dennis Sitelew
+ * @date   Oct. 18, 2026
+ *
+ * C-array initializers, compatible with xxd -i.
+ */
+#ifndef SIMPLE_HEX_PRINTER_INCLUDE_SHP_C_ARRAY_H
+#define SIMPLE_HEX_PRINTER_INCLUDE_SHP_C_ARRAY_H
+
+#include <shp/container_traits.h>
+#include <shp/core.h>
+#include <shp/ostream.h>
+
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <ostream>
+#include <string>
+#include <type_traits>
+
+namespace shp {
+
+////////////////////////////////////////////////////////////////////////////////
+/// Class: c_array_writer
+////////////////////////////////////////////////////////////////////////////////
+//! Helper class for writing iterator ranges as C-array initializers (similar to `xxd -i`) into an output stream.
+template <typename Iterator,
+          typename WithPrefix = Prefix,
+          typename RowWidthValue = RowWidth<12>,
+          typename InUpperCase = LowerCase>
+class c_array_writer {
+private:
+   static_assert(std::is_same<WithPrefix, Prefix>::value || std::is_same<WithPrefix, NoPrefix>::value,
+                 "Valid prefix type expected");
+
+   static_assert(std::is_same<InUpperCase, UpperCase>::value || std::is_same<InUpperCase, LowerCase>::value,
+                 "Valid case type expected");
+
+   static_assert(!std::is_same<RowWidthValue, SingleRow>::value, "Single row is not supported for C-arrays");
+
+   static_assert(RowWidthValue::value != 0, "Row width cannot be 0");
+
+   using iterator_t = Iterator;
+   using iterator_value_t = typename std::iterator_traits<iterator_t>::value_type;
+   using value_t = typename std::remove_cv<typename std::remove_reference<iterator_value_t>::type>::type;
+
+   static_assert(std::is_integral<value_t>::value || std::is_standard_layout<value_t>::value,
+                 "Iterator::value_type should either be an integral type or a POD type");
+
+   static const bool with_prefix = WithPrefix::value;
+   static const std::size_t row_width = RowWidthValue::value;
+   static const bool upper_case = InUpperCase::value;
+
+   //! Number of characters in a single value, followed by a comma and a space (or a new line)
+   static const std::size_t value_width = (with_prefix ? 4 : 2) + 2;
+
+   //! Maximal number of characters per value, including the row indentation
+   static const std::size_t max_value_width = value_width + 2;
+
+   //! Maximal number of values, formatted with a single sink buffer request
+   static const std::size_t max_chunk = detail::max_acquire_size / max_value_width;
+
+public:
+   /**
+    * Constructor
+    * @param begin Range begin
+    * @param end Range end
+    * @param name Array name. If empty, only the initializer values are printed, otherwise the output contains an
+    *             `unsigned char name[]` definition followed by the `unsigned int name_len` constant.
+    */
+   c_array_writer(iterator_t begin, iterator_t end, std::string name = {})
+      : begin_{begin}
+      , end_{end}
+      , name_{std::move(name)}
+      , total_size_{static_cast<std::size_t>(std::distance(begin, end)) * sizeof(value_t)} {
+      // Nothing to do here
+   }
+
+public:
+   /**
+    * Append the C-array initializer to a string, reusing the string capacity.
+    * The required space is calculated upfront, so the string is resized at most once.
+    * @param out Output string
+    */
+   template <typename Traits, typename Allocator>
+   void append_to(std::basic_string<char, Traits, Allocator> &out) const {
+      const detail::stats_recorder recorder{total_size_};
+
+      const auto offset = out.size();
+      const auto capacity = out.capacity();
+      const auto size = formatted_size();
+      out.resize(offset + size);
+
+      detail::pointer_sink sink{&out[offset]};
+      print_all(sink);
+
+      recorder.finish([size] { return size; }, out.capacity() != capacity ? 1 : 0);
+   }
+
+   /**
+    * Print the C-array initializer into a custom sink, @see iterator_hex_writer::print_to for the sink requirements.
+    * @param sink Output sink
+    */
+   template <typename Sink>
+   void print_to(Sink &sink) const {
+      const detail::stats_recorder recorder{total_size_};
+      print_all(sink);
+      recorder.finish([this] { return formatted_size(); });
+   }
+
+   /**
+    * Calculate the exact number of characters produced by this writer.
+    * @return Number of characters in the C-array initializer.
+    */
+   std::size_t formatted_size() const {
+      std::size_t result = 0;
+      if (total_size_ != 0) {
+         // Every value is followed by a separator, every row is indented and ends with a new line character
+         const std::size_t rows = (total_size_ + row_width - 1) / row_width;
+         result += total_size_ * value_width + rows * 2 - 1;
+      }
+
+      if (!name_.empty()) {
+         // Array definition and the length constant
+         result += sizeof(header_prefix) - 1 + name_.size() + sizeof(header_suffix) - 1;
+         result += sizeof(footer_prefix) - 1 + name_.size() + sizeof(footer_infix) - 1;
+         result += std::to_string(total_size_).size() + 2;
+      }
+      return result;
+   }
+
+public:
+   template <typename OIterator, typename OWithPrefix, typename ORowWidthValue, typename OInUpperCase>
+   friend std::ostream &operator<<(std::ostream &os,
+                                   const c_array_writer<OIterator, OWithPrefix, ORowWidthValue, OInUpperCase> &v);
+
+private:
+   static constexpr const char header_prefix[] = "unsigned char ";
+   static constexpr const char header_suffix[] = "[] = {\n";
+   static constexpr const char footer_prefix[] = "};\nunsigned int ";
+   static constexpr const char footer_infix[] = "_len = ";
+
+   template <typename Sink>
+   void print_values(Sink &sink, std::size_t &index, const std::uint8_t *data, std::size_t size) const {
+      const char *pairs = detail::hex_pairs<upper_case>();
+
+      while (size != 0) {
+         const std::size_t count = size < max_chunk ? size : max_chunk;
+
+         // Every value has the same width, so the values are written into the sink buffer directly
+         auto out = sink.acquire(count * max_value_width);
+         for (std::size_t i = 0; i < count; ++i, ++index) {
+            if (index % row_width == 0) {
+               *out++ = ' ';
+               *out++ = ' ';
+            }
+
+            if (with_prefix) {
+               *out++ = '0';
+               *out++ = 'x';
+            }
+            std::memcpy(out, pairs + data[i] * 2U, 2);
+            out += 2;
+
+            if (index + 1 == total_size_) {
+               *out++ = '\n';
+            } else {
+               *out++ = ',';
+               *out++ = (index + 1) % row_width == 0 ? '\n' : ' ';
+            }
+         }
+         sink.commit(out);
+
+         data += count;
+         size -= count;
+      }
+   }
+
+   template <typename Sink>
+   void print_all(Sink &sink) const {
+      if (!name_.empty()) {
+         write(sink, header_prefix);
+         write(sink, name_);
+         write(sink, header_suffix);
+      }
+
+      std::size_t index = 0;
+      detail::for_each_block(begin_, end_, [this, &sink, &index](const std::uint8_t *data, std::size_t size) {
+         print_values(sink, index, data, size);
+      });
+
+      if (!name_.empty()) {
+         write(sink, footer_prefix);
+         write(sink, name_);
+         write(sink, footer_infix);
+         write(sink, std::to_string(total_size_));
+         sink.write(";\n", 2);
+      }
+   }
+
+   template <typename Sink>
+   static void write(Sink &sink, const std::string &str) {
+      sink.write(str.data(), str.size());
+   }
+
+   template <typename Sink, std::size_t N>
+   static void write(Sink &sink, const char (&str)[N]) {
+      sink.write(str, N - 1);
+   }
+
+   void do_print(std::ostream &os) const {
+      const detail::stats_recorder recorder{total_size_};
+
+      detail::stream_sink sink{os};
+      print_all(sink);
+      sink.flush();
+
+      recorder.finish([this] { return formatted_size(); });
+   }
+
+private:
+   //! Range begin iterator
+   iterator_t begin_;
+
+   //! Range end iterator
+   iterator_t end_;
+
+   //! Array name
+   std::string name_;
+
+   //! Total number of bytes in the range
+   std::size_t total_size_;
+};
+
+template <typename Iterator, typename WithPrefix, typename RowWidthValue, typename InUpperCase>
+constexpr const char c_array_writer<Iterator, WithPrefix, RowWidthValue, InUpperCase>::header_prefix[];
+
+template <typename Iterator, typename WithPrefix, typename RowWidthValue, typename InUpperCase>
+constexpr const char c_array_writer<Iterator, WithPrefix, RowWidthValue, InUpperCase>::header_suffix[];
+
+template <typename Iterator, typename WithPrefix, typename RowWidthValue, typename InUpperCase>
+constexpr const char c_array_writer<Iterator, WithPrefix, RowWidthValue, InUpperCase>::footer_prefix[];
+
+template <typename Iterator, typename WithPrefix, typename RowWidthValue, typename InUpperCase>
+constexpr const char c_array_writer<Iterator, WithPrefix, RowWidthValue, InUpperCase>::footer_infix[];
+
+template <typename Iterator, typename WithPrefix, typename RowWidthValue, typename InUpperCase>
+std::ostream &operator<<(std::ostream &os, const c_array_writer<Iterator, WithPrefix, RowWidthValue, InUpperCase> &v) {
+   v.do_print(os);
+   return os;
+}
+
+/**
+ * Construct a streamable object for printing out a collection of POD-objects as a C-array initializer.
+ *
+ * @example std::cout << shp::c_array(data, "asset") << std::endl;
+ *
+ * @tparam ContainerT Container type.
+ * @tparam WithPrefix Controls whether the 0x prefix should be printed or not.
+ * @tparam RowWidthValue Number of values in a single row.
+ * @tparam InUpperCase Controls whether HEX values should be printed out in upper-case or not.
+ * @param cont Container to construct a streamable object for.
+ * @param name Array name, if empty - only the initializer values are printed.
+ * @return A streamable object.
+ */
+template <typename ContainerT,
+          typename WithPrefix = Prefix,
+          typename RowWidthValue = RowWidth<12>,
+          typename InUpperCase = LowerCase>
+inline typename std::enable_if<
+   is_container<ContainerT>::value && std::is_standard_layout<typename is_container<ContainerT>::element_type>::value,
+   c_array_writer<decltype(std::cbegin(std::declval<ContainerT>())), WithPrefix, RowWidthValue, InUpperCase>>::type
+c_array(const ContainerT &cont,
+        std::string name = {},
+        const WithPrefix = WithPrefix{},
+        const RowWidthValue = RowWidthValue{},
+        const InUpperCase = InUpperCase{}) {
+   return c_array_writer<decltype(std::cbegin(cont)), WithPrefix, RowWidthValue, InUpperCase>{
+      std::cbegin(cont), std::cend(cont), std::move(name)};
+}
+
+/**
+ * Convert a collection of POD-objects into a C-array initializer string.
+ *
+ * @example auto str = shp::c_array_str(data, "asset");
+ *
+ * @tparam ContainerT Container type.
+ * @tparam WithPrefix Controls whether the 0x prefix should be printed or not.
+ * @tparam RowWidthValue Number of values in a single row.
+ * @tparam InUpperCase Controls whether HEX values should be printed out in upper-case or not.
+ * @param cont Container to be converted.
+ * @param name Array name, if empty - only the initializer values are printed.
+ * @return A C-array initializer string.
+ */
+template <typename ContainerT,
+          typename WithPrefix = Prefix,
+          typename RowWidthValue = RowWidth<12>,
+          typename InUpperCase = LowerCase>
+inline typename std::enable_if<is_container<ContainerT>::value
+                                  && std::is_standard_layout<typename is_container<ContainerT>::element_type>::value,
+                               std::string>::type
+c_array_str(const ContainerT &cont,
+            std::string name = {},
+            const WithPrefix = WithPrefix{},
+            const RowWidthValue = RowWidthValue{},
+            const InUpperCase = InUpperCase{}) {
+   std::string result;
+   c_array(cont, std::move(name), WithPrefix{}, RowWidthValue{}, InUpperCase{}).append_to(result);
+   return result;
+}
+
+} // namespace shp
+
+#endif /* SIMPLE_HEX_PRINTER_INCLUDE_SHP_C_ARRAY_H */
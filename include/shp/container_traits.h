@@ -0,0 +1,209 @@
+/**
+ * @file   container_traits.h
+ * @author Dennis Sitelew
+ * @date   Oct. 18, 2026
+ *
+ * Detection of the supported containers and the memory layout of iterator ranges.
+ */
+#ifndef SIMPLE_HEX_PRINTER_INCLUDE_SHP_CONTAINER_TRAITS_H
+#define SIMPLE_HEX_PRINTER_INCLUDE_SHP_CONTAINER_TRAITS_H
+
+#include <shp/core.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <initializer_list>
+#include <iterator>
+#include <list>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#if SHP_CPLUSPLUS >= 201703L
+#include <string_view>
+#endif
+
+#if defined(__cpp_lib_span)
+#include <span>
+#endif
+
+namespace shp {
+
+namespace detail {
+
+//! The way of walking over the bytes of an iterator range
+enum class range_kind {
+   element_wise, //!< One element at a time
+   contiguous,   //!< All elements are stored in a single memory block
+   segmented,    //!< Elements are stored in multiple contiguous memory blocks (e.g. std::deque)
+};
+
+template <typename Iterator,
+          typename ValueT,
+          bool = !std::is_same<ValueT, bool>::value && !std::is_array<ValueT>::value>
+struct is_vector_iterator : std::false_type {};
+
+template <typename Iterator, typename ValueT>
+struct is_vector_iterator<Iterator, ValueT, true>
+   : std::integral_constant<bool,
+                            std::is_same<Iterator, typename std::vector<ValueT>::iterator>::value
+                               || std::is_same<Iterator, typename std::vector<ValueT>::const_iterator>::value> {};
+
+template <typename Iterator, typename ValueT>
+struct is_string_iterator : std::false_type {};
+
+template <typename Iterator>
+struct is_string_iterator<Iterator, char>
+   : std::integral_constant<bool,
+                            std::is_same<Iterator, std::string::iterator>::value
+                               || std::is_same<Iterator, std::string::const_iterator>::value> {};
+
+template <typename Iterator, typename ValueT, bool = !std::is_array<ValueT>::value>
+struct is_deque_iterator : std::false_type {};
+
+template <typename Iterator, typename ValueT>
+struct is_deque_iterator<Iterator, ValueT, true>
+   : std::integral_constant<bool,
+                            std::is_same<Iterator, typename std::deque<ValueT>::iterator>::value
+                               || std::is_same<Iterator, typename std::deque<ValueT>::const_iterator>::value> {};
+
+template <typename Iterator, typename ValueT>
+struct is_contiguous_iterator
+   : std::integral_constant<bool,
+#if defined(__cpp_lib_concepts)
+                            std::contiguous_iterator<Iterator>
+#else
+                            std::is_pointer<Iterator>::value || is_vector_iterator<Iterator, ValueT>::value
+                               || is_string_iterator<Iterator, ValueT>::value
+#endif
+                            > {
+};
+
+//! Classify an iterator type
+template <typename Iterator, typename ValueT>
+struct iterator_range_kind
+   : std::integral_constant<range_kind,
+                            is_contiguous_iterator<Iterator, ValueT>::value ? range_kind::contiguous
+                            : is_deque_iterator<Iterator, ValueT>::value    ? range_kind::segmented
+                                                                            : range_kind::element_wise> {};
+
+template <typename Iterator, typename Callback>
+inline void for_each_block(Iterator it,
+                           Iterator end,
+                           Callback &&callback,
+                           std::integral_constant<range_kind, range_kind::element_wise>) {
+   using value_t = typename std::iterator_traits<Iterator>::value_type;
+   for (; it != end; ++it) {
+      const value_t &value = *it;
+      callback(reinterpret_cast<const std::uint8_t *>(std::addressof(value)), sizeof(value_t));
+   }
+}
+
+template <typename Iterator, typename Callback>
+inline void for_each_block(Iterator it,
+                           Iterator end,
+                           Callback &&callback,
+                           std::integral_constant<range_kind, range_kind::contiguous>) {
+   using value_t = typename std::iterator_traits<Iterator>::value_type;
+   if (it != end) {
+      const auto size = static_cast<std::size_t>(std::distance(it, end)) * sizeof(value_t);
+      callback(reinterpret_cast<const std::uint8_t *>(std::addressof(*it)), size);
+   }
+}
+
+template <typename Iterator, typename Callback>
+inline void for_each_block(Iterator it,
+                           Iterator end,
+                           Callback &&callback,
+                           std::integral_constant<range_kind, range_kind::segmented>) {
+   using value_t = typename std::iterator_traits<Iterator>::value_type;
+
+   // The segment boundaries are not exposed by the standard library, so we look for the places where the next
+   // element doesn't follow the previous one in memory, and pass everything in between as a single block.
+   while (it != end) {
+      auto first = reinterpret_cast<const std::uint8_t *>(std::addressof(*it));
+      auto last = first + sizeof(value_t);
+      for (++it; it != end; ++it) {
+         auto next = reinterpret_cast<const std::uint8_t *>(std::addressof(*it));
+         if (next != last) {
+            break;
+         }
+         last += sizeof(value_t);
+      }
+      callback(first, static_cast<std::size_t>(last - first));
+   }
+}
+
+/**
+ * Walk over the bytes of an iterator range in the largest possible contiguous blocks.
+ *
+ * @param it Range begin.
+ * @param end Range end.
+ * @param callback Callable, receiving a pointer to the block bytes and the block size.
+ */
+template <typename Iterator, typename Callback>
+inline void for_each_block(Iterator it, Iterator end, Callback &&callback) {
+   using value_t = typename std::remove_cv<typename std::iterator_traits<Iterator>::value_type>::type;
+   for_each_block(it, end, std::forward<Callback>(callback), iterator_range_kind<Iterator, value_t>{});
+}
+
+} // namespace detail
+
+template <typename T>
+struct is_container : std::false_type {};
+
+template <typename T>
+struct is_container<std::vector<T>> : std::true_type {
+   using element_type = T;
+};
+
+template <typename T, std::size_t N>
+struct is_container<std::array<T, N>> : std::true_type {
+   using element_type = T;
+};
+
+template <typename T, std::size_t N>
+struct is_container<T[N]> : std::true_type {
+   using element_type = T;
+};
+
+template <>
+struct is_container<std::string> : std::true_type {
+   using element_type = std::string::value_type;
+};
+
+template <typename T>
+struct is_container<std::initializer_list<T>> : std::true_type {
+   using element_type = T;
+};
+
+template <typename T>
+struct is_container<std::deque<T>> : std::true_type {
+   using element_type = T;
+};
+
+template <typename T>
+struct is_container<std::list<T>> : std::true_type {
+   using element_type = T;
+};
+
+#if SHP_CPLUSPLUS >= 201703L
+template <>
+struct is_container<std::string_view> : std::true_type {
+   using element_type = std::string_view::value_type;
+};
+#endif
+
+#if defined(__cpp_lib_span)
+template <typename T, std::size_t Extent>
+struct is_container<std::span<T, Extent>> : std::true_type {
+   using element_type = T;
+};
+#endif
+
+} // namespace shp
+
+#endif /* SIMPLE_HEX_PRINTER_INCLUDE_SHP_CONTAINER_TRAITS_H */
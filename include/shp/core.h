@@ -0,0 +1,469 @@
+/**
+ * @file   core.h
+ * @author Dennis Sitelew
+ * @date   Oct. 18, 2026
+ *
+ * Format specifiers and the byte and integer formatting, without any stream or container dependencies.
+ */
+#ifndef SIMPLE_HEX_PRINTER_INCLUDE_SHP_CORE_H
+#define SIMPLE_HEX_PRINTER_INCLUDE_SHP_CORE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iosfwd>
+#include <limits>
+#include <type_traits>
+
+// MSVC only reports the correct standard version in __cplusplus with /Zc:__cplusplus
+#if defined(_MSVC_LANG)
+#define SHP_CPLUSPLUS _MSVC_LANG
+#else
+#define SHP_CPLUSPLUS __cplusplus
+#endif
+
+#if SHP_CPLUSPLUS >= 202002L
+#include <version>
+#endif
+
+#if defined(SHP_ENABLE_STATS)
+#include <shp/stats.h>
+
+#include <chrono>
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace shp {
+
+////////////////////////////////////////////////////////////////////////////////
+/// HEX Format Specifiers
+////////////////////////////////////////////////////////////////////////////////
+//! Add 0x prefix
+template <bool V>
+struct PrefixType : std::integral_constant<bool, V> {};
+struct Prefix : PrefixType<true> {};
+struct NoPrefix : PrefixType<false> {};
+
+//! Fill value with zeroes
+template <bool V>
+struct FillType : std::integral_constant<bool, V> {};
+struct Fill : FillType<true> {};
+struct NoFill : FillType<false> {};
+
+//! Print in Upper Case
+template <bool V>
+struct UpperCaseType : std::integral_constant<bool, V> {};
+struct UpperCase : UpperCaseType<true> {};
+struct LowerCase : UpperCaseType<false> {};
+
+//! Print byte offsets (address field)
+template <bool V>
+struct PrintOffsetsType : std::integral_constant<bool, V> {};
+struct PrintOffsets : PrintOffsetsType<true> {};
+struct NoOffsets : PrintOffsetsType<false> {};
+
+//! Separate nibbles
+template <bool V>
+struct SeparateNibblesType : std::integral_constant<bool, V> {};
+struct SeparateNibbles : SeparateNibblesType<true> {};
+struct NoNibbleSeparation : SeparateNibblesType<false> {};
+
+//! Row width
+template <std::size_t Sz>
+struct RowWidth : std::integral_constant<std::size_t, Sz> {};
+struct SingleRow : std::integral_constant<std::size_t, std::numeric_limits<std::size_t>::max()> {};
+
+//! Print ASCII values
+template <bool V>
+struct PrintASCIIType : std::integral_constant<bool, V> {};
+struct PrintASCII : PrintASCIIType<true> {};
+struct NoASCII : PrintASCIIType<false> {};
+
+//! Highlight search matches with ANSI escape sequences
+template <bool V>
+struct HighlightMatchesType : std::integral_constant<bool, V> {};
+struct HighlightMatches : HighlightMatchesType<true> {};
+struct NoHighlight : HighlightMatchesType<false> {};
+
+////////////////////////////////////////////////////////////////////////////////
+/// Formatting primitives
+////////////////////////////////////////////////////////////////////////////////
+namespace detail {
+
+//! HEX digits lookup table
+template <bool InUpperCase>
+inline const char *hex_digits() {
+   return InUpperCase ? "0123456789ABCDEF" : "0123456789abcdef";
+}
+
+//! Lookup table with two HEX digits for every byte value
+template <bool InUpperCase>
+struct hex_pair_table {
+   constexpr hex_pair_table()
+      : value{} {
+      const char digits[] = {'0', '1', '2', '3', '4', '5', '6', '7', '8', '9',
+                             InUpperCase ? 'A' : 'a', InUpperCase ? 'B' : 'b', InUpperCase ? 'C' : 'c',
+                             InUpperCase ? 'D' : 'd', InUpperCase ? 'E' : 'e', InUpperCase ? 'F' : 'f'};
+      for (std::size_t i = 0; i < 256; ++i) {
+         value[i * 2] = digits[i >> 4U];
+         value[i * 2 + 1] = digits[i & 0x0FU];
+      }
+   }
+
+   char value[512];
+};
+
+//! Two HEX digits for every byte value, the digits for a byte B start at offset 2 * B
+template <bool InUpperCase>
+inline const char *hex_pairs() {
+   static constexpr hex_pair_table<InUpperCase> table{};
+   return table.value;
+}
+
+//! Maximal number of characters, which can be requested from a sink at once
+constexpr std::size_t max_acquire_size = 512;
+
+#if defined(__SIZEOF_INT128__)
+#define SHP_HAS_INT128 1
+
+// The extension keyword silences the pedantic warnings about the non-standard types
+__extension__ typedef __int128 int128_t;
+__extension__ typedef unsigned __int128 uint128_t;
+#endif
+
+//! Integral types, which can be printed as numbers, including the 128-bit ones when the compiler has them
+template <typename T>
+struct is_integer_impl : std::is_integral<T> {};
+
+#if defined(SHP_HAS_INT128)
+template <>
+struct is_integer_impl<int128_t> : std::true_type {};
+
+template <>
+struct is_integer_impl<uint128_t> : std::true_type {};
+#endif
+
+template <typename T>
+struct is_integer : is_integer_impl<typename std::remove_cv<T>::type> {};
+
+//! Unsigned representation of an integral value, used for printing out its bits
+template <typename T>
+struct unsigned_of {
+   using type = typename std::make_unsigned<T>::type;
+};
+
+template <>
+struct unsigned_of<bool> {
+   using type = unsigned char;
+};
+
+#if defined(SHP_HAS_INT128)
+template <>
+struct unsigned_of<int128_t> {
+   using type = uint128_t;
+};
+
+template <>
+struct unsigned_of<uint128_t> {
+   using type = uint128_t;
+};
+#endif
+
+//! Number of significant bits in a non-zero value
+inline unsigned bit_width(std::uint64_t value) {
+#if defined(__GNUC__) || defined(__clang__)
+   return 64U - static_cast<unsigned>(__builtin_clzll(value));
+#elif defined(_MSC_VER)
+   unsigned long index;
+   if (_BitScanReverse(&index, static_cast<unsigned long>(value >> 32U))) {
+      return 33U + static_cast<unsigned>(index);
+   }
+   _BitScanReverse(&index, static_cast<unsigned long>(value));
+   return 1U + static_cast<unsigned>(index);
+#else
+   unsigned result = 0;
+   for (; value != 0; value >>= 1U) {
+      ++result;
+   }
+   return result;
+#endif
+}
+
+//! Number of HEX digits required for printing a value without leading zeroes
+inline std::size_t significant_digits(std::uint64_t bits) {
+   return bits == 0 ? 1U : (bit_width(bits) + 3U) / 4U;
+}
+
+#if defined(SHP_HAS_INT128)
+inline std::size_t significant_digits(uint128_t bits) {
+   const auto high = static_cast<std::uint64_t>(bits >> 64U);
+   return high == 0 ? significant_digits(static_cast<std::uint64_t>(bits)) : 16U + significant_digits(high);
+}
+#endif
+
+/**
+ * Convert the eight nibbles of a 32-bit value into HEX digits at once. The nibbles are spread into the bytes of a
+ * 64-bit word (the least significant nibble ends up in the least significant byte), and then every byte is mapped
+ * to a character without branches: the digits 10 to 15 overflow into the upper byte nibble after adding 6, which
+ * selects the offset between '9' and the letters.
+ */
+template <bool InUpperCase>
+inline std::uint64_t hex_digits_swar(std::uint32_t value) {
+   std::uint64_t x = value;
+   x = (x | (x << 16U)) & 0x0000FFFF0000FFFFULL;
+   x = (x | (x << 8U)) & 0x00FF00FF00FF00FFULL;
+   x = (x | (x << 4U)) & 0x0F0F0F0F0F0F0F0FULL;
+
+   const std::uint64_t letters = ((x + 0x0606060606060606ULL) >> 4U) & 0x0101010101010101ULL;
+   return x + 0x3030303030303030ULL + letters * (InUpperCase ? 0x07U : 0x27U);
+}
+
+//! Store the digits from hex_digits_swar, starting with the most significant one
+inline void store_digits(char *out, std::uint64_t digits) {
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+   std::memcpy(out, &digits, sizeof(digits));
+#elif defined(__GNUC__) || defined(__clang__)
+   digits = __builtin_bswap64(digits);
+   std::memcpy(out, &digits, sizeof(digits));
+#elif defined(_MSC_VER)
+   digits = _byteswap_uint64(digits);
+   std::memcpy(out, &digits, sizeof(digits));
+#else
+   for (unsigned i = 0; i < 8U; ++i) {
+      out[i] = static_cast<char>(digits >> (56U - 8U * i));
+   }
+#endif
+}
+
+//! Write all the digits of a value, starting with the most significant 32-bit chunk
+template <bool InUpperCase, typename U>
+inline void write_chunks(char *out, U bits, std::integral_constant<std::size_t, 1>) {
+   store_digits(out, hex_digits_swar<InUpperCase>(static_cast<std::uint32_t>(bits)));
+}
+
+template <bool InUpperCase, typename U, std::size_t N>
+inline void write_chunks(char *out, U bits, std::integral_constant<std::size_t, N>) {
+   store_digits(out, hex_digits_swar<InUpperCase>(static_cast<std::uint32_t>(bits >> (32U * (N - 1U)))));
+   write_chunks<InUpperCase>(out + 8, bits, std::integral_constant<std::size_t, N - 1U>{});
+}
+
+/**
+ * Write an integral value in HEX into a character buffer.
+ *
+ * @param out Output buffer, should be able to hold at least 2 + 2 * sizeof(T) characters.
+ * @param value Value to be written.
+ * @return Pointer past the last written character.
+ */
+template <typename T, bool WithPrefix, bool DoFill, bool InUpperCase>
+inline char *write_integral(char *out, T value) {
+   using unsigned_t = typename unsigned_of<typename std::remove_cv<T>::type>::type;
+
+   if (WithPrefix) {
+      *out++ = '0';
+      *out++ = 'x';
+   }
+
+   // All the digits are produced, 32 bits at a time, the leading zeroes are skipped afterwards
+   constexpr std::size_t chunks = (sizeof(T) + 3U) / 4U;
+   constexpr std::size_t max_digits = 2U * sizeof(T);
+   const auto bits = static_cast<unsigned_t>(value);
+
+   if (DoFill && chunks * 8U == max_digits) {
+      write_chunks<InUpperCase>(out, bits, std::integral_constant<std::size_t, chunks>{});
+      return out + max_digits;
+   }
+
+   char tmp[chunks * 8U];
+   write_chunks<InUpperCase>(tmp, bits, std::integral_constant<std::size_t, chunks>{});
+
+   using widest_t = typename std::conditional<(sizeof(unsigned_t) > 8U), unsigned_t, std::uint64_t>::type;
+   const std::size_t count = DoFill ? max_digits : significant_digits(static_cast<widest_t>(bits));
+   std::memcpy(out, tmp + sizeof(tmp) - count, count);
+   return out + count;
+}
+
+//! Sink writing into a character buffer, the buffer capacity is guaranteed by the caller.
+class pointer_sink {
+public:
+   explicit pointer_sink(char *out)
+      : out_{out} {
+      // Nothing to do here
+   }
+
+public:
+   void put(char c) { *out_++ = c; }
+
+   void write(const char *data, std::size_t size) {
+      std::memcpy(out_, data, size);
+      out_ += size;
+   }
+
+   //! Get a buffer for writing up to `size` characters directly, the written characters are marked with commit()
+   char *acquire(std::size_t) { return out_; }
+
+   //! Mark all the characters up to `end` as written
+   void commit(char *end) { out_ = end; }
+
+private:
+   char *out_;
+};
+
+} // namespace detail
+
+namespace detail {
+
+//! Records the statistics of a single formatting call
+class stats_recorder {
+public:
+#if defined(SHP_ENABLE_STATS)
+   explicit stats_recorder(std::size_t input_bytes)
+      : input_bytes_{input_bytes}
+      , start_{std::chrono::steady_clock::now()} {
+      // Nothing to do here
+   }
+
+   /**
+    * Record the call statistics.
+    * @param output_chars Callable, returning the number of produced characters (only invoked with the statistics on)
+    * @param allocations Number of output string allocations
+    */
+   template <typename OutputChars>
+   void finish(OutputChars &&output_chars, std::size_t allocations = 0) const {
+      const auto elapsed = std::chrono::steady_clock::now() - start_;
+
+      auto &slot = stats::detail::local_state().current();
+      stats::detail::add(slot.values[stats::detail::calls], 1);
+      stats::detail::add(slot.values[stats::detail::input_bytes], input_bytes_);
+      stats::detail::add(slot.values[stats::detail::output_chars], output_chars());
+      stats::detail::add(slot.values[stats::detail::allocations], allocations);
+      stats::detail::add(slot.values[stats::detail::elapsed_ns],
+                         static_cast<std::uint64_t>(
+                            std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()));
+   }
+
+private:
+   std::size_t input_bytes_;
+   std::chrono::steady_clock::time_point start_;
+#else
+   explicit stats_recorder(std::size_t) {
+      // Nothing to do here
+   }
+
+   template <typename OutputChars>
+   void finish(OutputChars &&, std::size_t = 0) const {
+      // Nothing to do here
+   }
+#endif
+};
+
+} // namespace detail
+
+////////////////////////////////////////////////////////////////////////////////
+/// Class: integral_hex_writer
+////////////////////////////////////////////////////////////////////////////////
+//! Helper class for writing integral types in the hex form into an output stream.
+template <typename T, typename WithPrefix = Prefix, typename DoFill = Fill, typename InUpperCase = UpperCase>
+class integral_hex_writer {
+private:
+   static_assert(std::is_same<WithPrefix, Prefix>::value || std::is_same<WithPrefix, NoPrefix>::value,
+                 "Valid prefix type expected");
+
+   static_assert(std::is_same<DoFill, Fill>::value || std::is_same<DoFill, NoFill>::value, "Valid Fill type expected");
+
+   static_assert(std::is_same<InUpperCase, UpperCase>::value || std::is_same<InUpperCase, LowerCase>::value,
+                 "Valid case type expected");
+
+   static_assert(detail::is_integer<T>::value, "T should be an integral type");
+
+public:
+   explicit integral_hex_writer(T value)
+      : value_{value} {
+      // Nothing to do here
+   }
+
+public:
+   /**
+    * Append the HEX representation of the value to a string, reusing the string capacity.
+    * @tparam String std::basic_string of char with any traits and allocator, deduced so that this header doesn't
+    *                depend on <string>
+    * @param out Output string
+    */
+   template <typename String>
+   void append_to(String &out) const {
+      const detail::stats_recorder recorder{sizeof(T)};
+      const auto capacity = out.capacity();
+
+      char buffer[max_size];
+      const auto last = detail::write_integral<T, WithPrefix::value, DoFill::value, InUpperCase::value>(buffer, value_);
+      out.append(buffer, static_cast<std::size_t>(last - buffer));
+
+      recorder.finish([&] { return static_cast<std::size_t>(last - buffer); }, out.capacity() != capacity ? 1 : 0);
+   }
+
+   /**
+    * Print the HEX representation of the value into a sink.
+    * @param sink Output sink
+    */
+   template <typename Sink>
+   void print_to(Sink &sink) const {
+      const detail::stats_recorder recorder{sizeof(T)};
+      char *out = sink.acquire(max_size);
+      const auto last = detail::write_integral<T, WithPrefix::value, DoFill::value, InUpperCase::value>(out, value_);
+      sink.commit(last);
+      recorder.finish([&] { return static_cast<std::size_t>(last - out); });
+   }
+
+   /**
+    * Calculate the exact number of characters produced by this writer.
+    * @return Number of characters in the HEX representation of the value.
+    */
+   std::size_t formatted_size() const {
+      using unsigned_t = typename detail::unsigned_of<typename std::remove_cv<T>::type>::type;
+      using widest_t = typename std::conditional<(sizeof(unsigned_t) > 8U), unsigned_t, std::uint64_t>::type;
+
+      const auto bits = static_cast<widest_t>(static_cast<unsigned_t>(value_));
+      const std::size_t digits = DoFill::value ? 2U * sizeof(T) : detail::significant_digits(bits);
+      return (WithPrefix::value ? 2U : 0U) + digits;
+   }
+
+public:
+   template <typename OT, typename OWithPrefix, typename ODoFill, typename OInUpperCase>
+   friend std::ostream &operator<<(std::ostream &os,
+                                   const integral_hex_writer<OT, OWithPrefix, ODoFill, OInUpperCase> &v);
+
+private:
+   //! Maximal number of characters in the HEX representation
+   static constexpr std::size_t max_size = 2U + 2U * sizeof(T);
+
+private:
+   T value_; //!< Value to be printed
+};
+
+////////////////////////////////////////////////////////////////////////////////
+/// Helper functions for constructing a streamable object
+////////////////////////////////////////////////////////////////////////////////
+/**
+ * Construct a streamable object for printing out an integral constant in HEX.
+ *
+ * @example std::cout << shp::hex(0xBEEF) << std::endl;
+ *
+ * @tparam T Integral type, including __int128 and unsigned __int128 when the compiler provides them.
+ * @tparam WithPrefix Controls whether the 0x prefix should be printed or not.
+ * @tparam DoFill Controls whether the printed out value should be filled (padded) with zeroes or not.
+ * @tparam InUpperCase Controls whether the HEX value should be printed in upper case or not.
+ * @param value Value to construct a streamable object from.
+ * @return A streamable object.
+ */
+template <typename T, typename WithPrefix = Prefix, typename DoFill = Fill, typename InUpperCase = UpperCase>
+inline
+   typename std::enable_if<detail::is_integer<T>::value, integral_hex_writer<T, WithPrefix, DoFill, InUpperCase>>::type
+   hex(const T &value, const WithPrefix = WithPrefix{}, const DoFill = DoFill{}, const InUpperCase = InUpperCase{}) {
+   return integral_hex_writer<T, WithPrefix, DoFill, InUpperCase>{value};
+}
+
+} // namespace shp
+
+#endif /* SIMPLE_HEX_PRINTER_INCLUDE_SHP_CORE_H */
@@ -0,0 +1,193 @@
+/**
+ * @file   hex_cursor.h
+ * @author Dennis Sitelew
+ * @date   Oct. 18, 2026
+ *
+ * Incremental HEX dumps, printed in parts.
+ */
+#ifndef SIMPLE_HEX_PRINTER_INCLUDE_SHP_HEX_CURSOR_H
+#define SIMPLE_HEX_PRINTER_INCLUDE_SHP_HEX_CURSOR_H
+
+#include <shp/container_traits.h>
+#include <shp/hex_dump.h>
+#include <shp/hex_str.h>
+
+#include <cstddef>
+#include <iterator>
+#include <string>
+#include <type_traits>
+
+namespace shp {
+
+////////////////////////////////////////////////////////////////////////////////
+/// Class: hex_dump_cursor
+////////////////////////////////////////////////////////////////////////////////
+/**
+ * Resumable HEX dump, producing the output of iterator_hex_writer in parts.
+ *
+ * Every step() call formats up to the given number of input bytes and returns, the offsets, the row position and the
+ * ASCII part of the current row are kept for the next call. Concatenated, the parts are identical to the full dump,
+ * which allows bounding the time spent per call (e.g. per event loop iteration) for arbitrary large ranges.
+ */
+template <typename Iterator,
+          typename WithOffsets = PrintOffsets,
+          typename WithNibbleSeparation = SeparateNibbles,
+          typename RowWidthValue = RowWidth<16>,
+          typename WithASCII = PrintASCII,
+          typename InUpperCase = UpperCase>
+class hex_dump_cursor {
+private:
+   using writer_t =
+      iterator_hex_writer<Iterator, WithOffsets, WithNibbleSeparation, RowWidthValue, WithASCII, InUpperCase>;
+   using print_state = typename writer_t::print_state;
+   using value_t = typename writer_t::value_t;
+
+   using iterator_t = Iterator;
+
+   static const std::size_t row_width = RowWidthValue::value;
+
+public:
+   hex_dump_cursor(iterator_t begin, iterator_t end)
+      : state_{writer_t{begin, end}} {
+      // Nothing to do here
+   }
+
+public:
+   /**
+    * Print the next part of the dump into a sink, @see iterator_hex_writer::print_to for the sink requirements.
+    * @param sink Output sink
+    * @param max_bytes Maximal number of input bytes to format
+    * @return true if there is more output left.
+    */
+   template <typename Sink>
+   bool step(Sink &sink, std::size_t max_bytes) {
+      const auto position = state_.global_offset;
+      const auto rest = state_.total_size - position;
+      const auto count = max_bytes < rest ? max_bytes : rest;
+      const detail::stats_recorder recorder{count};
+
+      if (count != 0) {
+         writer_t::print_range(sink, state_, skip_, count);
+
+         // Continue from the element, containing the next byte
+         const auto consumed = skip_ + count;
+         state_.it = std::next(state_.it, static_cast<std::ptrdiff_t>(consumed / sizeof(value_t)));
+         skip_ = consumed % sizeof(value_t);
+      }
+
+      if (state_.global_offset == state_.total_size && !finished_) {
+         if (state_.row_offset != 0) {
+            state_.ascii_cache.print_cached(sink);
+         }
+         finished_ = true;
+      }
+
+      recorder.finish([this, position] { return printed_size(state_.global_offset) - printed_size(position); });
+      return !finished_;
+   }
+
+   /**
+    * Print the next part of the dump, appending it to a string.
+    * @param out Output string
+    * @param max_bytes Maximal number of input bytes to format
+    * @return true if there is more output left.
+    */
+   bool step(std::string &out, std::size_t max_bytes) {
+      detail::string_sink sink{out};
+      return step(sink, max_bytes);
+   }
+
+   /**
+    * Print the next rows of the dump into a sink, an incomplete current row counts as one.
+    * @param sink Output sink
+    * @param rows Maximal number of rows to finish
+    * @return true if there is more output left.
+    */
+   template <typename Sink>
+   bool step_rows(Sink &sink, std::size_t rows) {
+      static_assert(!std::is_same<RowWidthValue, SingleRow>::value, "Row steps require a fixed row width");
+      return step(sink, rows == 0 ? 0 : rows * row_width - state_.row_offset);
+   }
+
+   //! Check whether the whole dump is printed
+   bool done() const { return finished_; }
+
+   //! Number of input bytes, printed so far
+   std::size_t position() const { return state_.global_offset; }
+
+   //! Total number of input bytes
+   std::size_t size() const { return state_.total_size; }
+
+   //! Number of characters in the whole dump
+   std::size_t formatted_size() const { return writer_t::formatted_size(state_.total_size, state_.address_width); }
+
+private:
+   //! Number of characters printed for the first `bytes` bytes, the ASCII part of the current row is printed last
+   std::size_t printed_size(std::size_t bytes) const {
+      if (bytes == state_.total_size) {
+         return formatted_size();
+      }
+
+      const std::size_t full = std::is_same<RowWidthValue, SingleRow>::value ? 0 : bytes / row_width * row_width;
+      std::size_t result = writer_t::formatted_size(full, state_.address_width);
+
+      const auto rest = bytes - full;
+      if (rest != 0) {
+         result += full != 0 ? 1 : 0;
+         result += WithOffsets::value ? state_.address_width + 4 : 0;
+         result += rest * writer_t::characters_per_byte - (WithNibbleSeparation::value ? 1 : 0);
+      }
+      return result;
+   }
+
+private:
+   print_state state_;
+
+   //! Number of leading bytes of the current element, which are already printed
+   std::size_t skip_{0};
+
+   //! Whether the end of the dump is printed
+   bool finished_{false};
+};
+
+/**
+ * Construct a resumable dump of a collection of POD-objects.
+ *
+ * @example auto cursor = shp::hex_cursor(capture); while (cursor.step(sink, 64 * 1024)) { yield(); }
+ *
+ * @tparam ContainerT Container type.
+ * @tparam WithOffsets Controls whether the row offsets should be printed out or not.
+ * @tparam WithNibbleSeparation Controls whether nibbles should be separated or not.
+ * @tparam RowWidthValue Number of bytes in a single row.
+ * @tparam WithASCII Controls whether ASCII values should be printed out or not.
+ * @tparam InUpperCase Controls whether HEX values should be printed out in upper-case or not.
+ * @param cont Container to construct a cursor for, should outlive the cursor.
+ * @return A dump cursor.
+ */
+template <typename ContainerT,
+          typename WithOffsets = PrintOffsets,
+          typename WithNibbleSeparation = SeparateNibbles,
+          typename RowWidthValue = RowWidth<16>,
+          typename WithASCII = PrintASCII,
+          typename InUpperCase = UpperCase>
+inline typename std::enable_if<is_container<ContainerT>::value
+                                  && std::is_standard_layout<typename is_container<ContainerT>::element_type>::value,
+                               hex_dump_cursor<decltype(std::cbegin(std::declval<ContainerT>())),
+                                               WithOffsets,
+                                               WithNibbleSeparation,
+                                               RowWidthValue,
+                                               WithASCII,
+                                               InUpperCase>>::type
+hex_cursor(const ContainerT &cont,
+           const WithOffsets = WithOffsets{},
+           const WithNibbleSeparation = WithNibbleSeparation{},
+           const RowWidthValue = RowWidthValue{},
+           const WithASCII = WithASCII{},
+           const InUpperCase = InUpperCase{}) {
+   return hex_dump_cursor<decltype(std::cbegin(cont)), WithOffsets, WithNibbleSeparation, RowWidthValue, WithASCII,
+                          InUpperCase>{std::cbegin(cont), std::cend(cont)};
+}
+
+} // namespace shp
+
+#endif /* SIMPLE_HEX_PRINTER_INCLUDE_SHP_HEX_CURSOR_H */
@@ -0,0 +1,901 @@
+/**
+ * @file   hex_dump.h
+ * @author Dennis Sitelew
+ * @date   Oct. 18, 2026
+ *
+ * HEX dumps of iterator ranges, containers and single objects.
+ */
+#ifndef SIMPLE_HEX_PRINTER_INCLUDE_SHP_HEX_DUMP_H
+#define SIMPLE_HEX_PRINTER_INCLUDE_SHP_HEX_DUMP_H
+
+#include <shp/container_traits.h>
+#include <shp/core.h>
+#include <shp/ostream.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace shp {
+
+namespace detail {
+
+//! Maximal size of a single object, formatted by pod_hex_writer
+constexpr std::size_t max_unrolled_size = 256;
+
+} // namespace detail
+
+template <typename Iterator,
+          typename WithOffsets,
+          typename WithNibbleSeparation,
+          typename RowWidthValue,
+          typename WithASCII,
+          typename InUpperCase>
+class hex_row_view;
+
+template <typename Iterator,
+          typename WithOffsets,
+          typename WithNibbleSeparation,
+          typename RowWidthValue,
+          typename WithASCII,
+          typename InUpperCase>
+class hex_dump_cursor;
+
+template <typename T,
+          typename WithOffsets,
+          typename WithNibbleSeparation,
+          typename RowWidthValue,
+          typename WithASCII,
+          typename InUpperCase>
+class pod_hex_writer;
+
+////////////////////////////////////////////////////////////////////////////////
+/// Class:
+////////////////////////////////////////////////////////////////////////////////
+//! Helper class for writing iterator ranges in the hex form into an output stream.
+template <typename Iterator,
+          typename WithOffsets = PrintOffsets,
+          typename WithNibbleSeparation = SeparateNibbles,
+          typename RowWidthValue = RowWidth<16>,
+          typename WithASCII = PrintASCII,
+          typename InUpperCase = UpperCase>
+class iterator_hex_writer {
+private:
+   static_assert(std::is_same<WithOffsets, PrintOffsets>::value || std::is_same<WithOffsets, NoOffsets>::value,
+                 "Valid offset type expected");
+
+   static_assert(std::is_same<WithNibbleSeparation, SeparateNibbles>::value
+                    || std::is_same<WithNibbleSeparation, NoNibbleSeparation>::value,
+                 "Valid nibble separation type expected");
+
+   static_assert(std::is_same<WithASCII, PrintASCII>::value || std::is_same<WithASCII, NoASCII>::value,
+                 "Valid ASCII type expected");
+
+   static_assert(std::is_same<InUpperCase, UpperCase>::value || std::is_same<InUpperCase, LowerCase>::value,
+                 "Valid case type expected");
+
+   static_assert(!std::is_same<RowWidthValue, SingleRow>::value
+                    || (std::is_same<RowWidthValue, SingleRow>::value
+                        && !(std::is_same<WithOffsets, PrintOffsets>::value
+                             || std::is_same<WithASCII, PrintASCII>::value)),
+                 "Single row printer should exclude offsets and ASCII");
+
+   static_assert(RowWidthValue::value != 0, "Row width cannot be 0");
+
+   using self_t =
+      iterator_hex_writer<Iterator, WithOffsets, WithNibbleSeparation, RowWidthValue, WithASCII, InUpperCase>;
+
+   using iterator_t = Iterator;
+   using iterator_value_t = typename std::iterator_traits<iterator_t>::value_type;
+   using value_t = typename std::remove_cv<typename std::remove_reference<iterator_value_t>::type>::type;
+
+   static_assert(std::is_integral<value_t>::value || std::is_standard_layout<value_t>::value,
+                 "Iterator::value_type should either be an integral type or a POD type");
+
+   static const bool with_offsets = WithOffsets::value;
+   static const bool separate_nibbles = WithNibbleSeparation::value;
+   static const std::size_t row_width = RowWidthValue::value;
+   static const bool single_row = std::is_same<RowWidthValue, SingleRow>::value;
+   static const bool with_ascii = WithASCII::value && !single_row;
+   static const bool upper_case = InUpperCase::value;
+
+   //! Number of characters, occupied by a single byte in the HEX part of a row
+   static const std::size_t characters_per_byte = separate_nibbles ? 3 : 2;
+
+   //! A single object of up to detail::max_unrolled_size bytes is printed by pod_hex_writer
+   using unrolled_t = std::integral_constant<bool,
+                                             std::is_same<iterator_t, const value_t *>::value
+                                                && sizeof(value_t) <= detail::max_unrolled_size>;
+
+   struct dummy_ascii_cache_t {
+      void add_bytes(const std::uint8_t *, std::size_t) {
+         // Nothing to do here
+      }
+
+      template <typename Sink>
+      void print_cached(Sink &) {
+         // Nothing to do here
+      }
+   };
+
+   struct ascii_cache_t {
+      void add_bytes(const std::uint8_t *data, std::size_t size) {
+         std::memcpy(cache.data() + offset, data, size);
+         offset += size;
+      }
+
+      // Print a subset of bytes in ASCII cache
+      template <typename Sink>
+      void print_cached(Sink &sink) {
+         if (offset != RowWidthValue::value) {
+            // We are printing the rest of the ASCII cache - add some padding
+            auto missing_bytes = RowWidthValue::value - offset;
+            for (std::size_t i = 0; i < missing_bytes * characters_per_byte; ++i) {
+               sink.put(' ');
+            }
+         }
+
+         sink.write("  ", 2);
+         for (std::size_t first = 0; first < offset; first += detail::max_acquire_size) {
+            const auto last = offset - first < detail::max_acquire_size ? offset : first + detail::max_acquire_size;
+            auto out = sink.acquire(last - first);
+            for (std::size_t i = first; i < last; ++i) {
+               *out++ = to_ascii(cache[i]);
+            }
+            sink.commit(out);
+         }
+         offset = 0;
+      }
+
+      std::size_t offset{0};
+      std::array<std::uint8_t, with_ascii ? RowWidthValue::value : 1> cache{};
+   };
+
+   // Helper struct to keep track of printing state. We use it because we want to be able to print POD-types without
+   // the byte printing boilerplate
+   struct print_state {
+      explicit print_state(const self_t &owner)
+         : it{owner.begin_}
+         , end{owner.end_}
+         , total_size{static_cast<std::size_t>(std::distance(it, end)) * sizeof(value_t)}
+         , base_offset{owner.base_offset_}
+         , address_width{with_offsets ? get_address_width(base_offset + total_size, owner.offset_width_) : 0} {
+         // Nothing to do here
+      }
+
+      //! Construct a state for printing a part of a range, starting at the byte offset `start`
+      print_state(iterator_t first, iterator_t last, std::size_t total, std::size_t start)
+         : it{first}
+         , end{last}
+         , total_size{total}
+         , address_width{with_offsets ? get_address_width(total_size) : 0}
+         , start_offset{start}
+         , global_offset{start} {
+         // Nothing to do here
+      }
+
+      static std::size_t get_address_width(std::size_t full_size, std::size_t min_width = 2) {
+         // Calculate the number of HEX digits required to encode all address values in the iterator range
+         std::size_t result = 0;
+         for (std::size_t reminder = full_size == 0 ? 0 : full_size - 1; reminder != 0; reminder /= 16, ++result) {
+            // Nothing to do here
+         }
+
+         // Print at least two address characters
+         min_width = min_width < 2 ? 2 : min_width;
+         return result < min_width ? min_width : result;
+      }
+
+      iterator_t it;
+      iterator_t end;
+
+      //! Total number of bytes in the range
+      const std::size_t total_size;
+
+      //! Offset, printed for the first byte of the range
+      const std::size_t base_offset{};
+
+      const std::size_t address_width;
+
+      //! Offset of the first printed byte, no row separator is printed before it
+      const std::size_t start_offset{};
+
+      std::size_t global_offset{};
+      std::size_t row_offset{};
+      typename std::conditional<with_ascii, ascii_cache_t, dummy_ascii_cache_t>::type ascii_cache;
+   };
+
+public:
+   iterator_hex_writer(iterator_t begin, iterator_t end)
+      : begin_{begin}
+      , end_{end} {
+      // Nothing to do here
+   }
+
+   explicit iterator_hex_writer(std::pair<iterator_t, iterator_t> range)
+      : begin_{range.first}
+      , end_{range.second} {
+      // Nothing to do here
+   }
+
+public:
+   /**
+    * Set the offset, printed for the first byte of the range, e.g. the position of the range within a file.
+    * The rows still start at the first byte of the range.
+    * @param offset Offset of the first byte
+    * @return Reference to this writer
+    */
+   self_t &base_offset(std::size_t offset) {
+      base_offset_ = offset;
+      return *this;
+   }
+
+   /**
+    * Set the minimal number of HEX digits in the printed offsets. By default the offsets are as wide as the last
+    * offset of the range requires, a fixed width keeps the separately printed parts of a stream aligned.
+    * @param digits Minimal number of digits
+    * @return Reference to this writer
+    */
+   self_t &offset_width(std::size_t digits) {
+      offset_width_ = digits;
+      return *this;
+   }
+
+public:
+   /**
+    * Append the HEX representation of the range to a string, reusing the string capacity.
+    * The required space is calculated upfront, so the string is resized at most once.
+    * @param out Output string
+    */
+   template <typename Traits, typename Allocator>
+   void append_to(std::basic_string<char, Traits, Allocator> &out) const {
+      if (use_unrolled()) {
+         append_unrolled(out, unrolled_t{});
+         return;
+      }
+
+      print_state ps{*this};
+      const detail::stats_recorder recorder{ps.total_size};
+
+      const auto offset = out.size();
+      const auto capacity = out.capacity();
+      const auto size = formatted_size(ps.total_size, ps.address_width);
+      out.resize(offset + size);
+
+      detail::pointer_sink sink{&out[offset]};
+      print_all(sink, ps);
+
+      recorder.finish([size] { return size; }, out.capacity() != capacity ? 1 : 0);
+   }
+
+   /**
+    * Print the HEX representation of the range into a custom sink.
+    *
+    * A sink should provide the following member functions:
+    *  - `void put(char c)` - write a single character;
+    *  - `void write(const char *data, std::size_t size)` - write a block of characters;
+    *  - `char *acquire(std::size_t size)` - get a buffer for writing up to `size` characters directly, `size` never
+    *    exceeds detail::max_acquire_size;
+    *  - `void commit(char *end)` - mark the characters in the acquired buffer up to `end` as written.
+    *
+    * @param sink Output sink
+    */
+   template <typename Sink>
+   void print_to(Sink &sink) const {
+      if (use_unrolled()) {
+         print_unrolled(sink, unrolled_t{});
+         return;
+      }
+
+      print_state ps{*this};
+      const detail::stats_recorder recorder{ps.total_size};
+      print_all(sink, ps);
+      recorder.finish([&ps] { return formatted_size(ps.total_size, ps.address_width); });
+   }
+
+   /**
+    * Calculate the exact number of characters produced by this writer.
+    * @return Number of characters in the HEX representation of the range.
+    */
+   std::size_t formatted_size() const {
+      print_state ps{*this};
+      return formatted_size(ps.total_size, ps.address_width);
+   }
+
+public:
+   template <typename OIterator,
+             typename OWithOffsets,
+             typename OWithNibbleSeparation,
+             typename ORowWidthValue,
+             typename OWithASCII,
+             typename OInUpperCase>
+   friend std::ostream &operator<<(std::ostream &os,
+                                   const iterator_hex_writer<OIterator,
+                                                             OWithOffsets,
+                                                             OWithNibbleSeparation,
+                                                             ORowWidthValue,
+                                                             OWithASCII,
+                                                             OInUpperCase> &v);
+
+   template <typename, typename, typename, typename, typename, typename>
+   friend class hex_row_view;
+
+   template <typename, typename, typename, typename, typename, typename>
+   friend class hex_dump_cursor;
+
+   template <typename, typename, typename, typename, typename>
+   friend class pcap_dump_writer;
+
+private:
+   static std::size_t formatted_size(std::size_t bytes, std::size_t address_width) {
+      if (bytes == 0) {
+         return 0;
+      }
+
+      const std::size_t rows = single_row ? 1 : (bytes + row_width - 1) / row_width;
+
+      // Row separators and address fields: "0x" + address + ": "
+      std::size_t result = rows - 1;
+      if (with_offsets) {
+         result += rows * (address_width + 4);
+      }
+
+      if (with_ascii) {
+         // Every row is padded to the full width, followed by two spaces and the ASCII characters
+         const std::size_t full_row = row_width * characters_per_byte - (separate_nibbles ? 1 : 0);
+         result += rows * (full_row + 2) + bytes;
+      } else {
+         result += bytes * 2 + (separate_nibbles ? bytes - rows : 0);
+      }
+      return result;
+   }
+
+   static char to_ascii(std::uint8_t byte) {
+      // Printable characters of the "C" locale
+      return byte >= 0x20U && byte < 0x7FU ? static_cast<char>(byte) : '.';
+   }
+
+   template <typename Sink>
+   static void print_offset(Sink &sink, const print_state &s) {
+      const char *digits = detail::hex_digits<upper_case>();
+      sink.write("0x", 2);
+      for (std::size_t i = s.address_width; i != 0; --i) {
+         sink.put(digits[((s.base_offset + s.global_offset) >> ((i - 1) * 4U)) & 0x0FU]);
+      }
+      sink.write(": ", 2);
+   }
+
+   //! Print a block of bytes, splitting it into rows
+   template <typename Sink>
+   static void print_bytes(Sink &sink, print_state &s, const std::uint8_t *data, std::size_t size) {
+      // Maximal number of bytes, formatted with a single sink buffer request
+      constexpr std::size_t max_chunk = detail::max_acquire_size / characters_per_byte;
+      const char *pairs = detail::hex_pairs<upper_case>();
+
+      while (size != 0) {
+         if (s.row_offset == 0) {
+            if (s.global_offset != s.start_offset) {
+               sink.put('\n');
+            }
+
+            if (with_offsets) {
+               print_offset(sink, s);
+            }
+         }
+
+         std::size_t count = row_width - s.row_offset;
+         count = count < size ? count : size;
+         count = count < max_chunk ? count : max_chunk;
+
+         auto out = sink.acquire(count * characters_per_byte);
+         for (std::size_t i = 0; i < count; ++i) {
+            if (separate_nibbles && (i != 0 || s.row_offset != 0)) {
+               *out++ = ' ';
+            }
+            std::memcpy(out, pairs + data[i] * 2U, 2);
+            out += 2;
+         }
+         sink.commit(out);
+
+         s.ascii_cache.add_bytes(data, count);
+
+         data += count;
+         size -= count;
+         s.global_offset += count;
+         s.row_offset += count;
+
+         if (s.row_offset == row_width) {
+            s.ascii_cache.print_cached(sink);
+            s.row_offset = 0;
+         }
+      }
+   }
+
+   template <typename Sink>
+   static void print_all(Sink &sink, print_state &ps) {
+      detail::for_each_block(ps.it, ps.end, [&sink, &ps](const std::uint8_t *data, std::size_t size) {
+         print_bytes(sink, ps, data, size);
+      });
+      ps.it = ps.end;
+
+      if (ps.row_offset != 0) {
+         ps.ascii_cache.print_cached(sink);
+      }
+   }
+
+   /**
+    * Print a part of the range, the ASCII part of an incomplete last row is kept in the state cache.
+    * @param sink Output sink
+    * @param ps State, positioned at the first byte to print
+    * @param skip Number of leading bytes of `*ps.it` which are already printed
+    * @param count Number of bytes to print
+    */
+   template <typename Sink>
+   static void print_range(Sink &sink, print_state &ps, std::size_t skip, std::size_t count) {
+      // Elements, covering the bytes
+      const auto elements = (skip + count + sizeof(value_t) - 1) / sizeof(value_t);
+      detail::for_each_block(ps.it, std::next(ps.it, static_cast<std::ptrdiff_t>(elements)),
+                             [&](const std::uint8_t *data, std::size_t size) {
+                                if (skip >= size) {
+                                   skip -= size;
+                                   return;
+                                }
+
+                                data += skip;
+                                size -= skip;
+                                skip = 0;
+
+                                size = size < count ? size : count;
+                                print_bytes(sink, ps, data, size);
+                                count -= size;
+                             });
+   }
+
+   /**
+    * Print a single row, without the trailing row separator.
+    * @param sink Output sink
+    * @param ps State, constructed at the row start offset
+    * @param skip Number of leading bytes of `*ps.it` belonging to the previous row
+    * @param count Number of bytes in the row
+    */
+   template <typename Sink>
+   static void print_row(Sink &sink, print_state &ps, std::size_t skip, std::size_t count) {
+      print_range(sink, ps, skip, count);
+
+      if (ps.row_offset != 0) {
+         ps.ascii_cache.print_cached(sink);
+      }
+   }
+
+   //! Whether the range is a single object, printed by pod_hex_writer, which doesn't support the offset settings
+   bool use_unrolled() const {
+      return unrolled_t::value && std::distance(begin_, end_) == 1 && base_offset_ == 0 && offset_width_ == 0;
+   }
+
+   template <typename Traits, typename Allocator>
+   void append_unrolled(std::basic_string<char, Traits, Allocator> &out, std::true_type) const {
+      pod_hex_writer<value_t, WithOffsets, WithNibbleSeparation, RowWidthValue, WithASCII, InUpperCase>{*begin_}
+         .append_to(out);
+   }
+
+   template <typename Traits, typename Allocator>
+   void append_unrolled(std::basic_string<char, Traits, Allocator> &, std::false_type) const {
+      // Nothing to do here
+   }
+
+   template <typename Sink>
+   void print_unrolled(Sink &sink, std::true_type) const {
+      pod_hex_writer<value_t, WithOffsets, WithNibbleSeparation, RowWidthValue, WithASCII, InUpperCase>{*begin_}
+         .print_to(sink);
+   }
+
+   template <typename Sink>
+   void print_unrolled(Sink &, std::false_type) const {
+      // Nothing to do here
+   }
+
+   void do_print(std::ostream &os) const {
+      detail::stream_sink sink{os};
+      if (use_unrolled()) {
+         print_unrolled(sink, unrolled_t{});
+         sink.flush();
+         return;
+      }
+
+      print_state ps{*this};
+      const detail::stats_recorder recorder{ps.total_size};
+
+      print_all(sink, ps);
+      sink.flush();
+
+      recorder.finish([&ps] { return formatted_size(ps.total_size, ps.address_width); });
+   }
+
+private:
+   //! Range begin iterator
+   iterator_t begin_;
+
+   //! Range end iterator
+   iterator_t end_;
+
+   //! Offset, printed for the first byte
+   std::size_t base_offset_{0};
+
+   //! Minimal number of digits in the printed offsets
+   std::size_t offset_width_{0};
+};
+
+template <typename Iterator,
+          typename WithOffsets,
+          typename WithNibbleSeparation,
+          typename RowWidthValue,
+          typename WithASCII,
+          typename InUpperCase>
+std::ostream &operator<<(
+   std::ostream &os,
+   const iterator_hex_writer<Iterator, WithOffsets, WithNibbleSeparation, RowWidthValue, WithASCII, InUpperCase> &v) {
+   v.do_print(os);
+   return os;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Class: pod_hex_writer
+////////////////////////////////////////////////////////////////////////////////
+/**
+ * Helper class for writing a single POD-object in the hex form, producing the same output as iterator_hex_writer.
+ *
+ * The object size is known at compile time, so is the whole output layout: the row breaks, offsets and padding are
+ * taken from a constant template, and only the HEX digits and the ASCII characters are filled in, with a fully
+ * unrolled store per byte. The single object helpers (hex, hex_str, append_hex) use it for objects of up to
+ * detail::max_unrolled_size bytes.
+ */
+template <typename T,
+          typename WithOffsets = PrintOffsets,
+          typename WithNibbleSeparation = SeparateNibbles,
+          typename RowWidthValue = RowWidth<16>,
+          typename WithASCII = PrintASCII,
+          typename InUpperCase = UpperCase>
+class pod_hex_writer {
+private:
+   static_assert(std::is_same<WithOffsets, PrintOffsets>::value || std::is_same<WithOffsets, NoOffsets>::value,
+                 "Valid offset type expected");
+
+   static_assert(std::is_same<WithNibbleSeparation, SeparateNibbles>::value
+                    || std::is_same<WithNibbleSeparation, NoNibbleSeparation>::value,
+                 "Valid nibble separation type expected");
+
+   static_assert(std::is_same<WithASCII, PrintASCII>::value || std::is_same<WithASCII, NoASCII>::value,
+                 "Valid ASCII type expected");
+
+   static_assert(std::is_same<InUpperCase, UpperCase>::value || std::is_same<InUpperCase, LowerCase>::value,
+                 "Valid case type expected");
+
+   static_assert(!std::is_same<RowWidthValue, SingleRow>::value
+                    || (std::is_same<RowWidthValue, SingleRow>::value
+                        && !(std::is_same<WithOffsets, PrintOffsets>::value
+                             || std::is_same<WithASCII, PrintASCII>::value)),
+                 "Single row printer should exclude offsets and ASCII");
+
+   static_assert(RowWidthValue::value != 0, "Row width cannot be 0");
+
+   static_assert(std::is_standard_layout<T>::value, "T should be a POD type");
+
+   static_assert(sizeof(T) <= detail::max_unrolled_size, "Larger objects should be printed with iterator_hex_writer");
+
+   static constexpr std::size_t bytes = sizeof(T);
+   static constexpr bool with_offsets = WithOffsets::value;
+   static constexpr bool separate_nibbles = WithNibbleSeparation::value;
+   static constexpr bool single_row = std::is_same<RowWidthValue, SingleRow>::value;
+   static constexpr bool with_ascii = WithASCII::value && !single_row;
+   static constexpr bool upper_case = InUpperCase::value;
+
+   //! Bytes per row, a single row holds the whole object
+   static constexpr std::size_t row_width = single_row ? bytes : RowWidthValue::value;
+
+   //! Number of characters, occupied by a single byte in the HEX part of a row
+   static constexpr std::size_t characters_per_byte = separate_nibbles ? 3 : 2;
+
+   static constexpr std::size_t rows = (bytes + row_width - 1) / row_width;
+
+   //! Bytes in the last row
+   static constexpr std::size_t last_row_bytes = bytes - (rows - 1) * row_width;
+
+   //! Number of HEX digits in the offsets, the same as iterator_hex_writer prints for the whole object
+   static constexpr std::size_t address_width() {
+      std::size_t result = 0;
+      for (std::size_t reminder = bytes - 1; reminder != 0; reminder /= 16, ++result) {
+         // Nothing to do here
+      }
+      return result < 2 ? 2 : result;
+   }
+
+   //! "0x" + address + ": "
+   static constexpr std::size_t offset_length = with_offsets ? address_width() + 4 : 0;
+
+   //! HEX part of a full row
+   static constexpr std::size_t hex_length = row_width * characters_per_byte - (separate_nibbles ? 1 : 0);
+
+   //! Full row, without the row separator
+   static constexpr std::size_t row_length = offset_length + hex_length + (with_ascii ? 2 + row_width : 0);
+
+   static constexpr std::size_t output_size =
+      (rows - 1) * (row_length + 1) + offset_length
+      + (with_ascii ? hex_length + 2 + last_row_bytes
+                    : last_row_bytes * 2 + (separate_nibbles ? last_row_bytes - 1 : 0));
+
+   //! Position of the HEX digits of the byte `index` in the output
+   static constexpr std::size_t hex_position(std::size_t index) {
+      return (index / row_width) * (row_length + 1) + offset_length + (index % row_width) * characters_per_byte;
+   }
+
+   //! Position of the ASCII character of the byte `index` in the output
+   static constexpr std::size_t ascii_position(std::size_t index) {
+      return (index / row_width) * (row_length + 1) + offset_length + hex_length + 2 + index % row_width;
+   }
+
+   //! Output with all the characters, which don't depend on the object value
+   struct output_template {
+      constexpr output_template()
+         : value{} {
+         const char digits[] = {'0', '1', '2', '3', '4', '5', '6', '7', '8', '9',
+                                upper_case ? 'A' : 'a', upper_case ? 'B' : 'b', upper_case ? 'C' : 'c',
+                                upper_case ? 'D' : 'd', upper_case ? 'E' : 'e', upper_case ? 'F' : 'f'};
+
+         for (std::size_t i = 0; i < output_size; ++i) {
+            value[i] = ' ';
+         }
+
+         for (std::size_t row = 0; row < rows; ++row) {
+            const std::size_t start = row * (row_length + 1);
+            if (row != 0) {
+               value[start - 1] = '\n';
+            }
+
+            if (with_offsets) {
+               const std::size_t offset = row * row_width;
+               value[start] = '0';
+               value[start + 1] = 'x';
+               for (std::size_t i = 0; i < address_width(); ++i) {
+                  value[start + 2 + i] = digits[(offset >> ((address_width() - 1 - i) * 4U)) & 0x0FU];
+               }
+               value[start + 2 + address_width()] = ':';
+            }
+         }
+      }
+
+      char value[output_size];
+   };
+
+public:
+   explicit pod_hex_writer(const T &value)
+      : value_{std::addressof(value)} {
+      // Nothing to do here
+   }
+
+public:
+   /**
+    * Format the HEX representation of the object into an array.
+    * @return Array with the characters of the HEX representation, without a terminating zero.
+    */
+   std::array<char, output_size> to_array() const {
+      const detail::stats_recorder recorder{bytes};
+      std::array<char, output_size> result;
+      format(result.data());
+      recorder.finish([] { return output_size; });
+      return result;
+   }
+
+   /**
+    * Append the HEX representation of the object to a string, reusing the string capacity.
+    * @param out Output string
+    */
+   template <typename Traits, typename Allocator>
+   void append_to(std::basic_string<char, Traits, Allocator> &out) const {
+      const detail::stats_recorder recorder{bytes};
+
+      const auto offset = out.size();
+      const auto capacity = out.capacity();
+      out.resize(offset + output_size);
+      format(&out[offset]);
+
+      recorder.finish([] { return output_size; }, out.capacity() != capacity ? 1 : 0);
+   }
+
+   /**
+    * Print the HEX representation of the object into a sink.
+    * @param sink Output sink
+    */
+   template <typename Sink>
+   void print_to(Sink &sink) const {
+      const detail::stats_recorder recorder{bytes};
+      char buffer[output_size];
+      format(buffer);
+      sink.write(buffer, output_size);
+      recorder.finish([] { return output_size; });
+   }
+
+   /**
+    * Get the exact number of characters produced by this writer.
+    * @return Number of characters in the HEX representation of the object.
+    */
+   static constexpr std::size_t formatted_size() { return output_size; }
+
+public:
+   template <typename OT,
+             typename OWithOffsets,
+             typename OWithNibbleSeparation,
+             typename ORowWidthValue,
+             typename OWithASCII,
+             typename OInUpperCase>
+   friend std::ostream &operator<<(
+      std::ostream &os,
+      const pod_hex_writer<OT, OWithOffsets, OWithNibbleSeparation, ORowWidthValue, OWithASCII, OInUpperCase> &v);
+
+private:
+   static char to_ascii(std::uint8_t byte) {
+      // Printable characters of the "C" locale
+      return byte >= 0x20U && byte < 0x7FU ? static_cast<char>(byte) : '.';
+   }
+
+   template <std::size_t Index>
+   static void format_byte(char *out, const char *pairs, const std::uint8_t *data) {
+      std::memcpy(out + hex_position(Index), pairs + data[Index] * 2U, 2);
+      if (with_ascii) {
+         out[ascii_position(Index)] = to_ascii(data[Index]);
+      }
+   }
+
+   template <std::size_t... Index>
+   static void format_bytes(char *out, const std::uint8_t *data, std::index_sequence<Index...>) {
+      const char *pairs = detail::hex_pairs<upper_case>();
+      const int expand[] = {(format_byte<Index>(out, pairs, data), 0)...};
+      static_cast<void>(expand);
+   }
+
+   //! Write exactly output_size characters
+   void format(char *out) const {
+      static constexpr output_template layout{};
+      std::memcpy(out, layout.value, output_size);
+      format_bytes(out, reinterpret_cast<const std::uint8_t *>(value_), std::make_index_sequence<bytes>{});
+   }
+
+private:
+   const T *value_; //!< Object to be printed
+};
+
+template <typename T,
+          typename WithOffsets,
+          typename WithNibbleSeparation,
+          typename RowWidthValue,
+          typename WithASCII,
+          typename InUpperCase>
+std::ostream &
+operator<<(std::ostream &os,
+           const pod_hex_writer<T, WithOffsets, WithNibbleSeparation, RowWidthValue, WithASCII, InUpperCase> &v) {
+   using writer_t = pod_hex_writer<T, WithOffsets, WithNibbleSeparation, RowWidthValue, WithASCII, InUpperCase>;
+   const detail::stats_recorder recorder{sizeof(T)};
+
+   char buffer[writer_t::output_size];
+   v.format(buffer);
+   os.write(buffer, static_cast<std::streamsize>(writer_t::output_size));
+
+   recorder.finish([] { return writer_t::output_size; });
+   return os;
+}
+
+namespace detail {
+
+//! Single object writer: objects up to max_unrolled_size bytes use the unrolled writer, larger ones the generic one
+template <typename T,
+          typename WithOffsets,
+          typename WithNibbleSeparation,
+          typename RowWidthValue,
+          typename WithASCII,
+          typename InUpperCase>
+using object_hex_writer = typename std::conditional<
+   (sizeof(T) <= max_unrolled_size),
+   pod_hex_writer<T, WithOffsets, WithNibbleSeparation, RowWidthValue, WithASCII, InUpperCase>,
+   iterator_hex_writer<const T *, WithOffsets, WithNibbleSeparation, RowWidthValue, WithASCII, InUpperCase>>::type;
+
+template <typename Writer, typename T>
+inline Writer make_object_writer(const T &v, std::true_type) {
+   return Writer{v};
+}
+
+template <typename Writer, typename T>
+inline Writer make_object_writer(const T &v, std::false_type) {
+   return Writer{std::addressof(v), std::addressof(v) + 1};
+}
+
+//! Construct the writer for a single object
+template <typename Writer, typename T>
+inline Writer make_object_writer(const T &v) {
+   return make_object_writer<Writer>(v, std::integral_constant<bool, (sizeof(T) <= max_unrolled_size)>{});
+}
+
+} // namespace detail
+
+////////////////////////////////////////////////////////////////////////////////
+/// Helper functions for constructing a streamable object
+////////////////////////////////////////////////////////////////////////////////
+/**
+ * Construct a streamable object for printing out a collection of POD-objects in HEX.
+ *
+ * @example struct { int a; int b; } q[2] = {{1, 2}, {3, 4}}; std::cout << shp::hex(q) << std::endl;
+ *
+ * @tparam ContainerT Container type.
+ * @tparam WithOffsets Controls whether the row offsets should be printed out or not.
+ * @tparam WithNibbleSeparation Controls whether nibbles should be separated or not.
+ * @tparam RowWidthValue Maximal of a single row (in bytes).
+ * @tparam WithASCII Controls whether ASCII values should be printed out or not.
+ * @tparam InUpperCase Controls whether HEX values should be printed out in upper-case or not.
+ * @param cont Container to construct a streamable object for.
+ * @return A streamable object.
+ */
+template <typename ContainerT,
+          typename WithOffsets = PrintOffsets,
+          typename WithNibbleSeparation = SeparateNibbles,
+          typename RowWidthValue = RowWidth<16>,
+          typename WithASCII = PrintASCII,
+          typename InUpperCase = UpperCase>
+inline typename std::enable_if<is_container<ContainerT>::value
+                                  && std::is_standard_layout<typename is_container<ContainerT>::element_type>::value,
+                               iterator_hex_writer<decltype(std::cbegin(std::declval<ContainerT>())),
+                                                   WithOffsets,
+                                                   WithNibbleSeparation,
+                                                   RowWidthValue,
+                                                   WithASCII,
+                                                   InUpperCase>>::type
+hex(const ContainerT &cont,
+    const WithOffsets = WithOffsets{},
+    const WithNibbleSeparation = WithNibbleSeparation{},
+    const RowWidthValue = RowWidthValue{},
+    const WithASCII = WithASCII{},
+    const InUpperCase = InUpperCase{}) {
+   return iterator_hex_writer<decltype(std::cbegin(cont)), WithOffsets, WithNibbleSeparation, RowWidthValue, WithASCII,
+                              InUpperCase>{std::cbegin(cont), std::cend(cont)};
+}
+
+/**
+ * Construct a streamable object for printing out a single POD-object in HEX.
+ *
+ * @example struct { int a; int b; } q = {1, 2}; std::cout << shp::hex(q) << std::endl;
+ *
+ * @tparam T Object type.
+ * @tparam WithOffsets Controls whether the row offsets should be printed out or not.
+ * @tparam WithNibbleSeparation Controls whether nibbles should be separated or not.
+ * @tparam RowWidthValue Maximal of a single row (in bytes).
+ * @tparam WithASCII Controls whether ASCII values should be printed out or not.
+ * @tparam InUpperCase Controls whether HEX values should be printed out in upper-case or not.
+ * @param cont Container to construct a streamable object for.
+ * @return A streamable object.
+ */
+template <typename T,
+          typename WithOffsets = PrintOffsets,
+          typename WithNibbleSeparation = SeparateNibbles,
+          typename RowWidthValue = RowWidth<16>,
+          typename WithASCII = PrintASCII,
+          typename InUpperCase = UpperCase>
+inline typename std::enable_if<
+   !is_container<T>::value && std::is_standard_layout<T>::value && !detail::is_integer<T>::value,
+   iterator_hex_writer<const T *, WithOffsets, WithNibbleSeparation, RowWidthValue, WithASCII, InUpperCase>>::type
+hex(const T &v,
+    const WithOffsets = WithOffsets{},
+    const WithNibbleSeparation = WithNibbleSeparation{},
+    const RowWidthValue = RowWidthValue{},
+    const WithASCII = WithASCII{},
+    const InUpperCase = InUpperCase{}) {
+   return iterator_hex_writer<const T *, WithOffsets, WithNibbleSeparation, RowWidthValue, WithASCII, InUpperCase>{
+      std::addressof(v), std::addressof(v) + 1};
+}
+
+} // namespace shp
+
+#endif /* SIMPLE_HEX_PRINTER_INCLUDE_SHP_HEX_DUMP_H */
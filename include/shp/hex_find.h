@@ -0,0 +1,447 @@
+/**
+ * @file   hex_find.h
+ * @author Dennis Sitelew
+ * @date   Oct. 18, 2026
+ *
+ * Searching for byte patterns and printing the matching rows.
+ */
+#ifndef SIMPLE_HEX_PRINTER_INCLUDE_SHP_HEX_FIND_H
+#define SIMPLE_HEX_PRINTER_INCLUDE_SHP_HEX_FIND_H
+
+#include <shp/container_traits.h>
+#include <shp/hex_dump.h>
+#include <shp/hex_rows.h>
+#include <shp/hex_str.h>
+#include <shp/ostream.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace shp {
+
+////////////////////////////////////////////////////////////////////////////////
+/// Pattern search
+////////////////////////////////////////////////////////////////////////////////
+namespace detail {
+
+//! Byte pattern search with memchr, which is vectorized by the C library, and memcmp
+class pattern_finder {
+public:
+   explicit pattern_finder(const std::string &pattern)
+      : pattern_{pattern} {
+      // Zeroes and 0xFF are the most common bytes in binary data, so the scan is done for the first other byte
+      for (std::size_t i = 0; i < pattern_.size(); ++i) {
+         const auto c = static_cast<std::uint8_t>(pattern_[i]);
+         if (c != 0x00U && c != 0xFFU) {
+            pivot_ = i;
+            break;
+         }
+      }
+   }
+
+public:
+   //! Pattern size in bytes
+   std::size_t size() const { return pattern_.size(); }
+
+   /**
+    * Find the first (possibly overlapping) match, starting in [from, to).
+    * @param data Data to search in
+    * @param size Data size
+    * @param from First match offset to check
+    * @param to End of the match offsets to check, only the bytes up to `to + size() - 1` are read
+    * @return Offset of the match or `to` if there is none
+    */
+   std::size_t find(const std::uint8_t *data, std::size_t size, std::size_t from, std::size_t to) const {
+      const auto length = pattern_.size();
+      if (length == 0 || length > size) {
+         return to;
+      }
+
+      const auto limit = to < size - length + 1 ? to : size - length + 1;
+      if (from >= limit) {
+         return to;
+      }
+
+      const auto needle = reinterpret_cast<const std::uint8_t *>(pattern_.data());
+      const auto last = data + limit + pivot_;
+      for (auto p = data + from + pivot_; p < last; ++p) {
+         p = static_cast<const std::uint8_t *>(std::memchr(p, needle[pivot_], static_cast<std::size_t>(last - p)));
+         if (p == nullptr) {
+            break;
+         }
+
+         const auto start = p - pivot_;
+         if (std::memcmp(start, needle, length) == 0) {
+            return static_cast<std::size_t>(start - data);
+         }
+      }
+      return to;
+   }
+
+private:
+   std::string pattern_;
+   std::size_t pivot_{0};
+};
+
+/**
+ * Find all (possibly overlapping) occurrences of a pattern.
+ * @return Offsets of the matches in ascending order
+ */
+inline std::vector<std::size_t> find_all(const std::uint8_t *data, std::size_t size, const pattern_finder &finder) {
+   std::vector<std::size_t> result;
+   for (auto match = finder.find(data, size, 0, size); match < size; match = finder.find(data, size, match + 1, size)) {
+      result.push_back(match);
+   }
+   return result;
+}
+
+} // namespace detail
+
+/**
+ * Convert a HEX string into a search pattern.
+ *
+ * @example shp::hex_find(data, shp::hex_pattern("DE AD BE EF"), 2);
+ *
+ * @param text HEX digits with an optional 0x prefix, whitespaces are ignored.
+ * @return Pattern bytes.
+ * @throw std::invalid_argument If the text is not a valid HEX string.
+ */
+inline std::string hex_pattern(const std::string &text) {
+   auto is_space = [](char c) { return c == ' ' || c == '\t' || c == '\n' || c == '\r'; };
+
+   std::size_t first = 0;
+   while (first < text.size() && is_space(text[first])) {
+      ++first;
+   }
+   if (text.compare(first, 2, "0x") == 0 || text.compare(first, 2, "0X") == 0) {
+      first += 2;
+   }
+
+   std::string result;
+   int high = -1;
+   for (std::size_t i = first; i < text.size(); ++i) {
+      const auto c = text[i];
+
+      int nibble = 0;
+      if (c >= '0' && c <= '9') {
+         nibble = c - '0';
+      } else if (c >= 'a' && c <= 'f') {
+         nibble = c - 'a' + 10;
+      } else if (c >= 'A' && c <= 'F') {
+         nibble = c - 'A' + 10;
+      } else if (is_space(c)) {
+         continue;
+      } else {
+         throw std::invalid_argument{"Invalid character in HEX pattern: '" + text + "'"};
+      }
+
+      if (high < 0) {
+         high = nibble;
+      } else {
+         result.push_back(static_cast<char>(high * 16 + nibble));
+         high = -1;
+      }
+   }
+
+   if (high >= 0) {
+      throw std::invalid_argument{"Odd number of digits in HEX pattern: '" + text + "'"};
+   }
+   return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Class: hex_match_writer
+////////////////////////////////////////////////////////////////////////////////
+/**
+ * Helper class for printing the rows around pattern matches.
+ *
+ * The output consists of the rows containing the matches plus the requested number of context rows around them, in
+ * the same format as iterator_hex_writer prints them (with absolute offsets). Non-adjacent row groups are separated
+ * by a "--" line. The matches can be highlighted with ANSI escape sequences, which is only useful on a terminal.
+ *
+ * The matches are searched for while printing and never stored, so the memory usage doesn't depend on their number.
+ */
+template <typename Iterator,
+          typename WithOffsets = PrintOffsets,
+          typename WithNibbleSeparation = SeparateNibbles,
+          typename RowWidthValue = RowWidth<16>,
+          typename WithASCII = PrintASCII,
+          typename InUpperCase = UpperCase,
+          typename WithHighlight = NoHighlight>
+class hex_match_writer {
+private:
+   static_assert(std::is_same<WithHighlight, HighlightMatches>::value
+                    || std::is_same<WithHighlight, NoHighlight>::value,
+                 "Valid highlight type expected");
+
+   using rows_t = hex_row_view<Iterator, WithOffsets, WithNibbleSeparation, RowWidthValue, WithASCII, InUpperCase>;
+
+   using iterator_t = Iterator;
+   using value_t = typename std::remove_cv<typename std::iterator_traits<iterator_t>::value_type>::type;
+
+   static_assert(detail::iterator_range_kind<iterator_t, value_t>::value == detail::range_kind::contiguous,
+                 "Pattern search requires a contiguous range");
+
+   static const std::size_t row_width = RowWidthValue::value;
+   static const bool with_ascii = WithASCII::value;
+   static const bool highlight = WithHighlight::value;
+   static const std::size_t characters_per_byte = WithNibbleSeparation::value ? 3 : 2;
+
+public:
+   /**
+    * Constructor
+    * @param begin Range begin
+    * @param end Range end
+    * @param pattern Pattern bytes, an empty pattern has no matches
+    * @param context_rows Number of rows to print before and after the rows with matches
+    */
+   hex_match_writer(iterator_t begin, iterator_t end, const std::string &pattern, std::size_t context_rows)
+      : rows_{begin, end}
+      , finder_{pattern}
+      , context_rows_{context_rows} {
+      if (begin != end) {
+         data_ = reinterpret_cast<const std::uint8_t *>(std::addressof(*begin));
+         size_ = static_cast<std::size_t>(std::distance(begin, end)) * sizeof(value_t);
+      }
+   }
+
+public:
+   //! Whether the pattern occurs in the range, stops at the first match
+   bool has_matches() const { return find(0, size_) < size_; }
+
+   //! Byte offsets of all matches, searched for on every call, prefer printing or has_matches() for large ranges
+   std::vector<std::size_t> matches() const { return detail::find_all(data_, size_, finder_); }
+
+   /**
+    * Append the matching rows to a string
+    * @param out Output string
+    */
+   template <typename Traits, typename Allocator>
+   void append_to(std::basic_string<char, Traits, Allocator> &out) const {
+      detail::basic_string_sink<Traits, Allocator> sink{out};
+      print_all(sink);
+   }
+
+   /**
+    * Print the matching rows into a custom sink.
+    * @param sink Output sink, see iterator_hex_writer::print_to for the requirements
+    */
+   template <typename Sink>
+   void print_to(Sink &sink) const {
+      print_all(sink);
+   }
+
+public:
+   template <typename OIterator,
+             typename OWithOffsets,
+             typename OWithNibbleSeparation,
+             typename ORowWidthValue,
+             typename OWithASCII,
+             typename OInUpperCase,
+             typename OWithHighlight>
+   friend std::ostream &operator<<(std::ostream &os,
+                                   const hex_match_writer<OIterator,
+                                                          OWithOffsets,
+                                                          OWithNibbleSeparation,
+                                                          ORowWidthValue,
+                                                          OWithASCII,
+                                                          OInUpperCase,
+                                                          OWithHighlight> &v);
+
+private:
+   //! First match, starting in [from, to), `to` if there is none
+   std::size_t find(std::size_t from, std::size_t to) const { return finder_.find(data_, size_, from, to); }
+
+   //! First row to print for a match
+   std::size_t first_row(std::size_t match) const {
+      const auto row = match / row_width;
+      return row > context_rows_ ? row - context_rows_ : 0;
+   }
+
+   //! Last row to print for a match
+   std::size_t last_row(std::size_t match) const {
+      const auto row = (match + finder_.size() - 1) / row_width + context_rows_;
+      return row < rows_.size() - 1 ? row : rows_.size() - 1;
+   }
+
+   template <typename Sink>
+   void print_all(Sink &sink) const {
+      // Rendered row, reused for highlighting
+      std::string line;
+
+      bool first_group = true;
+      for (auto match = find(0, size_); match < size_;) {
+         // Matches with overlapping or adjacent rows are printed as a single group
+         const auto first = first_row(match);
+         auto last = last_row(match);
+         for (match = find(match + 1, size_); match < size_ && first_row(match) <= last + 1;
+              match = find(match + 1, size_)) {
+            last = last_row(match);
+         }
+
+         if (!first_group) {
+            sink.write("\n--\n", 4);
+         }
+         first_group = false;
+
+         for (auto row = first; row <= last; ++row) {
+            if (row != first) {
+               sink.put('\n');
+            }
+            print_row(sink, line, row);
+         }
+      }
+   }
+
+   template <typename Sink>
+   void print_row(Sink &sink, std::string &line, std::size_t row) const {
+      if (!highlight) {
+         rows_.print_row(row, sink);
+         return;
+      }
+
+      const auto pattern_size = finder_.size();
+      const auto row_begin = row * row_width;
+      const auto row_end = row_begin + row_width;
+
+      // Bytes of the row, covered by the matches, which start in the row or end in it
+      std::array<bool, row_width> covered{};
+      const auto search_begin = row_begin >= pattern_size - 1 ? row_begin - (pattern_size - 1) : 0;
+      for (auto match = find(search_begin, row_end); match < row_end; match = find(match + 1, row_end)) {
+         const auto from = match > row_begin ? match - row_begin : 0;
+         const auto to = match + pattern_size - row_begin;
+         for (auto j = from; j < to && j < row_width; ++j) {
+            covered[j] = true;
+         }
+      }
+
+      line.clear();
+      rows_.append_row(row, line);
+
+      const std::size_t hex_start = rows_.address_width_ + (WithOffsets::value ? 4 : 0);
+      const std::size_t full_row = row_width * characters_per_byte - (WithNibbleSeparation::value ? 1 : 0);
+      const std::size_t ascii_start = hex_start + full_row + 2;
+
+      std::size_t written = 0;
+      auto write_until = [&](std::size_t position) {
+         sink.write(line.data() + written, position - written);
+         written = position;
+      };
+
+      // Wrap the runs of covered bytes into the escape sequences, in the HEX part first, then in the ASCII part
+      for (int part = 0; part < (with_ascii ? 2 : 1); ++part) {
+         for (std::size_t first = 0; first < row_width;) {
+            if (!covered[first]) {
+               ++first;
+               continue;
+            }
+
+            auto last = first;
+            while (last + 1 < row_width && covered[last + 1]) {
+               ++last;
+            }
+
+            if (part == 0) {
+               write_until(hex_start + first * characters_per_byte);
+               sink.write("\x1b[1;31m", 7);
+               write_until(hex_start + last * characters_per_byte + 2);
+            } else {
+               write_until(ascii_start + first);
+               sink.write("\x1b[1;31m", 7);
+               write_until(ascii_start + last + 1);
+            }
+            sink.write("\x1b[0m", 4);
+
+            first = last + 1;
+         }
+      }
+      write_until(line.size());
+   }
+
+private:
+   rows_t rows_;
+   detail::pattern_finder finder_;
+   std::size_t context_rows_;
+
+   const std::uint8_t *data_{nullptr};
+   std::size_t size_{0};
+};
+
+template <typename Iterator,
+          typename WithOffsets,
+          typename WithNibbleSeparation,
+          typename RowWidthValue,
+          typename WithASCII,
+          typename InUpperCase,
+          typename WithHighlight>
+std::ostream &operator<<(std::ostream &os,
+                         const hex_match_writer<Iterator,
+                                                WithOffsets,
+                                                WithNibbleSeparation,
+                                                RowWidthValue,
+                                                WithASCII,
+                                                InUpperCase,
+                                                WithHighlight> &v) {
+   detail::stream_sink sink{os};
+   v.print_all(sink);
+   sink.flush();
+   return os;
+}
+
+/**
+ * Search a collection of POD-objects for a byte pattern and construct a streamable object, printing the matching
+ * rows with some context around them.
+ *
+ * @example std::cout << shp::hex_find(core, shp::hex_pattern("DEADBEEF"), 2) << std::endl;
+ *
+ * @tparam ContainerT Container type, should be contiguous.
+ * @tparam WithOffsets Controls whether the row offsets should be printed out or not.
+ * @tparam WithNibbleSeparation Controls whether nibbles should be separated or not.
+ * @tparam RowWidthValue Number of bytes in a single row.
+ * @tparam WithASCII Controls whether ASCII values should be printed out or not.
+ * @tparam InUpperCase Controls whether HEX values should be printed out in upper-case or not.
+ * @tparam WithHighlight Controls whether the matches should be highlighted with ANSI escape sequences or not.
+ * @param cont Container to search in, should outlive the returned object.
+ * @param pattern Raw pattern bytes, see hex_pattern() for patterns given as HEX strings.
+ * @param context_rows Number of rows to print before and after the rows with matches.
+ * @return A streamable object.
+ */
+template <typename ContainerT,
+          typename WithOffsets = PrintOffsets,
+          typename WithNibbleSeparation = SeparateNibbles,
+          typename RowWidthValue = RowWidth<16>,
+          typename WithASCII = PrintASCII,
+          typename InUpperCase = UpperCase,
+          typename WithHighlight = NoHighlight>
+inline typename std::enable_if<is_container<ContainerT>::value
+                                  && std::is_standard_layout<typename is_container<ContainerT>::element_type>::value,
+                               hex_match_writer<decltype(std::cbegin(std::declval<ContainerT>())),
+                                                WithOffsets,
+                                                WithNibbleSeparation,
+                                                RowWidthValue,
+                                                WithASCII,
+                                                InUpperCase,
+                                                WithHighlight>>::type
+hex_find(const ContainerT &cont,
+         const std::string &pattern,
+         std::size_t context_rows = 0,
+         const WithOffsets = WithOffsets{},
+         const WithNibbleSeparation = WithNibbleSeparation{},
+         const RowWidthValue = RowWidthValue{},
+         const WithASCII = WithASCII{},
+         const InUpperCase = InUpperCase{},
+         const WithHighlight = WithHighlight{}) {
+   return hex_match_writer<decltype(std::cbegin(cont)), WithOffsets, WithNibbleSeparation, RowWidthValue, WithASCII,
+                           InUpperCase, WithHighlight>{std::cbegin(cont), std::cend(cont), pattern, context_rows};
+}
+
+} // namespace shp
+
+#endif /* SIMPLE_HEX_PRINTER_INCLUDE_SHP_HEX_FIND_H */
@@ -0,0 +1,246 @@
+/**
+ * @file   hex_join.h
+ * @author Dennis Sitelew
+ * @date   Oct. 18, 2026
+ *
+ * Sequences of integral values, printed as numbers separated by a delimiter.
+ */
+#ifndef SIMPLE_HEX_PRINTER_INCLUDE_SHP_HEX_JOIN_H
+#define SIMPLE_HEX_PRINTER_INCLUDE_SHP_HEX_JOIN_H
+
+#include <shp/container_traits.h>
+#include <shp/core.h>
+#include <shp/ostream.h>
+
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <ostream>
+#include <string>
+#include <type_traits>
+
+namespace shp {
+
+////////////////////////////////////////////////////////////////////////////////
+/// Class: hex_join_writer
+////////////////////////////////////////////////////////////////////////////////
+//! Helper class for writing a sequence of integral values in HEX, separated by a delimiter (e.g. `0x01, 0x02`).
+template <typename Iterator, typename WithPrefix = Prefix, typename DoFill = Fill, typename InUpperCase = UpperCase>
+class hex_join_writer {
+private:
+   static_assert(std::is_same<WithPrefix, Prefix>::value || std::is_same<WithPrefix, NoPrefix>::value,
+                 "Valid prefix type expected");
+
+   static_assert(std::is_same<DoFill, Fill>::value || std::is_same<DoFill, NoFill>::value, "Valid Fill type expected");
+
+   static_assert(std::is_same<InUpperCase, UpperCase>::value || std::is_same<InUpperCase, LowerCase>::value,
+                 "Valid case type expected");
+
+   using iterator_t = Iterator;
+   using iterator_value_t = typename std::iterator_traits<iterator_t>::value_type;
+   using value_t = typename std::remove_cv<typename std::remove_reference<iterator_value_t>::type>::type;
+   using unsigned_t = typename detail::unsigned_of<value_t>::type;
+   using widest_t = typename std::conditional<(sizeof(unsigned_t) > 8U), unsigned_t, std::uint64_t>::type;
+
+   static_assert(detail::is_integer<value_t>::value, "Iterator::value_type should be an integral type");
+
+   //! Number of characters in a filled value
+   static const std::size_t filled_width = (WithPrefix::value ? 2U : 0U) + 2U * sizeof(value_t);
+
+   //! Buffer space, required for writing a single value
+   static const std::size_t value_capacity = 2U + 2U * sizeof(value_t);
+
+public:
+   /**
+    * Constructor
+    * @param begin Range begin
+    * @param end Range end
+    * @param separator String, written between the values
+    */
+   hex_join_writer(iterator_t begin, iterator_t end, std::string separator = ", ")
+      : begin_{begin}
+      , end_{end}
+      , separator_{std::move(separator)}
+      , count_{static_cast<std::size_t>(std::distance(begin, end))} {
+      // Nothing to do here
+   }
+
+public:
+   /**
+    * Append the joined values to a string, reusing the string capacity.
+    * The required space is calculated upfront, so the string is resized at most once.
+    * @param out Output string
+    */
+   template <typename Traits, typename Allocator>
+   void append_to(std::basic_string<char, Traits, Allocator> &out) const {
+      const detail::stats_recorder recorder{count_ * sizeof(value_t)};
+
+      const auto offset = out.size();
+      const auto capacity = out.capacity();
+      const auto size = formatted_size();
+      out.resize(offset + size);
+
+      detail::pointer_sink sink{&out[offset]};
+      print_all(sink);
+
+      recorder.finish([size] { return size; }, out.capacity() != capacity ? 1 : 0);
+   }
+
+   /**
+    * Print the joined values into a custom sink, @see iterator_hex_writer::print_to for the sink requirements.
+    * @param sink Output sink
+    */
+   template <typename Sink>
+   void print_to(Sink &sink) const {
+      const detail::stats_recorder recorder{count_ * sizeof(value_t)};
+      print_all(sink);
+      recorder.finish([this] { return formatted_size(); });
+   }
+
+   /**
+    * Calculate the exact number of characters produced by this writer.
+    * Filled values have the same width, so only the values without the fill are visited.
+    * @return Number of characters in the joined values.
+    */
+   std::size_t formatted_size() const {
+      if (count_ == 0) {
+         return 0;
+      }
+
+      std::size_t result = (count_ - 1) * separator_.size();
+      if (DoFill::value) {
+         return result + count_ * filled_width;
+      }
+
+      result += WithPrefix::value ? count_ * 2U : 0U;
+      for (auto it = begin_; it != end_; ++it) {
+         result += detail::significant_digits(static_cast<widest_t>(static_cast<unsigned_t>(*it)));
+      }
+      return result;
+   }
+
+public:
+   template <typename OIterator, typename OWithPrefix, typename ODoFill, typename OInUpperCase>
+   friend std::ostream &operator<<(std::ostream &os,
+                                   const hex_join_writer<OIterator, OWithPrefix, ODoFill, OInUpperCase> &v);
+
+private:
+   static char *write_value(char *out, value_t value) {
+      return detail::write_integral<value_t, WithPrefix::value, DoFill::value, InUpperCase::value>(out, value);
+   }
+
+   template <typename Sink>
+   void print_all(Sink &sink) const {
+      if (count_ == 0) {
+         return;
+      }
+
+      auto it = begin_;
+      sink.commit(write_value(sink.acquire(value_capacity), *it++));
+
+      // The separated values are written in batches, with a single sink buffer request per batch
+      const std::size_t stride = separator_.size() + value_capacity;
+      const std::size_t batch = stride <= detail::max_acquire_size ? detail::max_acquire_size / stride : 0;
+      while (it != end_) {
+         if (batch == 0) {
+            sink.write(separator_.data(), separator_.size());
+            sink.commit(write_value(sink.acquire(value_capacity), *it++));
+            continue;
+         }
+
+         auto out = sink.acquire(batch * stride);
+         for (std::size_t i = 0; i < batch && it != end_; ++i, ++it) {
+            std::memcpy(out, separator_.data(), separator_.size());
+            out = write_value(out + separator_.size(), *it);
+         }
+         sink.commit(out);
+      }
+   }
+
+   void do_print(std::ostream &os) const {
+      const detail::stats_recorder recorder{count_ * sizeof(value_t)};
+
+      detail::stream_sink sink{os};
+      print_all(sink);
+      sink.flush();
+
+      recorder.finish([this] { return formatted_size(); });
+   }
+
+private:
+   //! Range begin iterator
+   iterator_t begin_;
+
+   //! Range end iterator
+   iterator_t end_;
+
+   //! Separator between the values
+   std::string separator_;
+
+   //! Number of values in the range
+   std::size_t count_;
+};
+
+template <typename Iterator, typename WithPrefix, typename DoFill, typename InUpperCase>
+std::ostream &operator<<(std::ostream &os, const hex_join_writer<Iterator, WithPrefix, DoFill, InUpperCase> &v) {
+   v.do_print(os);
+   return os;
+}
+
+/**
+ * Construct a streamable object for printing out a collection of integral values in HEX, separated by a delimiter.
+ * Unlike shp::hex, the values are printed as numbers, not as the bytes they consist of.
+ *
+ * @example std::cout << shp::hex_join(addresses) << std::endl; // 0x00001000, 0x00002000
+ *
+ * @tparam ContainerT Container type.
+ * @tparam WithPrefix Controls whether the 0x prefix should be printed or not.
+ * @tparam DoFill Controls whether the printed out values should be filled (padded) with zeroes or not.
+ * @tparam InUpperCase Controls whether the HEX values should be printed in upper case or not.
+ * @param cont Container to construct a streamable object for.
+ * @param separator String, written between the values.
+ * @return A streamable object.
+ */
+template <typename ContainerT, typename WithPrefix = Prefix, typename DoFill = Fill, typename InUpperCase = UpperCase>
+inline typename std::enable_if<
+   is_container<ContainerT>::value && detail::is_integer<typename is_container<ContainerT>::element_type>::value,
+   hex_join_writer<decltype(std::cbegin(std::declval<ContainerT>())), WithPrefix, DoFill, InUpperCase>>::type
+hex_join(const ContainerT &cont,
+         std::string separator = ", ",
+         const WithPrefix = WithPrefix{},
+         const DoFill = DoFill{},
+         const InUpperCase = InUpperCase{}) {
+   return hex_join_writer<decltype(std::cbegin(cont)), WithPrefix, DoFill, InUpperCase>{
+      std::cbegin(cont), std::cend(cont), std::move(separator)};
+}
+
+/**
+ * Convert a collection of integral values into a string of HEX values, separated by a delimiter.
+ *
+ * @example auto str = shp::hex_join_str(ids, " ", shp::NoPrefix{}, shp::NoFill{});
+ *
+ * @tparam ContainerT Container type.
+ * @tparam WithPrefix Controls whether the 0x prefix should be printed or not.
+ * @tparam DoFill Controls whether the printed out values should be filled (padded) with zeroes or not.
+ * @tparam InUpperCase Controls whether the HEX values should be printed in upper case or not.
+ * @param cont Container to be converted.
+ * @param separator String, written between the values.
+ * @return A string with the joined values.
+ */
+template <typename ContainerT, typename WithPrefix = Prefix, typename DoFill = Fill, typename InUpperCase = UpperCase>
+inline typename std::enable_if<
+   is_container<ContainerT>::value && detail::is_integer<typename is_container<ContainerT>::element_type>::value,
+   std::string>::type
+hex_join_str(const ContainerT &cont,
+             std::string separator = ", ",
+             const WithPrefix = WithPrefix{},
+             const DoFill = DoFill{},
+             const InUpperCase = InUpperCase{}) {
+   std::string result;
+   hex_join(cont, std::move(separator), WithPrefix{}, DoFill{}, InUpperCase{}).append_to(result);
+   return result;
+}
+
+} // namespace shp
+
+#endif /* SIMPLE_HEX_PRINTER_INCLUDE_SHP_HEX_JOIN_H */
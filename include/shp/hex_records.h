@@ -0,0 +1,830 @@
+/**
+ * @file   hex_records.h
+ * @author Dennis Sitelew
+ * @date   Oct. 18, 2026
+ *
+ * Intel HEX and Motorola S-record emitters and parsers.
+ */
+#ifndef SIMPLE_HEX_PRINTER_INCLUDE_SHP_HEX_RECORDS_H
+#define SIMPLE_HEX_PRINTER_INCLUDE_SHP_HEX_RECORDS_H
+
+#include <shp/container_traits.h>
+#include <shp/core.h>
+#include <shp/ostream.h>
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace shp {
+
+namespace detail {
+
+//! Emitter settings, shared by the record formats
+struct record_settings {
+   record_settings(std::uint64_t base, std::size_t total, std::size_t record)
+      : base_address{base}
+      , total_size{total}
+      , record_size{record} {
+      // Nothing to do here
+   }
+
+   std::uint64_t base_address;
+   std::size_t total_size;
+   std::size_t record_size;
+
+   bool has_start_address{false};
+   std::uint32_t start_address{0};
+
+   std::string header;
+};
+
+//! Write bytes in upper case HEX, @return Sum of the bytes
+template <typename Sink>
+inline unsigned write_record_bytes(Sink &sink, const std::uint8_t *data, std::size_t size) {
+   constexpr std::size_t max_chunk = max_acquire_size / 2;
+   const char *pairs = hex_pairs<true>();
+
+   unsigned sum = 0;
+   while (size != 0) {
+      const auto count = size < max_chunk ? size : max_chunk;
+
+      auto out = sink.acquire(count * 2);
+      for (std::size_t i = 0; i < count; ++i) {
+         std::memcpy(out, pairs + data[i] * 2U, 2);
+         out += 2;
+         sum += data[i];
+      }
+      sink.commit(out);
+
+      data += count;
+      size -= count;
+   }
+   return sum;
+}
+
+/**
+ * Write a complete record line.
+ * @param sink Output sink
+ * @param start Record start characters
+ * @param fields Record fields, preceding the data (byte count, address, type)
+ * @param data Record data
+ * @param size Data size
+ * @param ones_complement Use the S-record checksum (ones' complement of the sum) instead of the Intel HEX one (two's
+ *                        complement of the sum)
+ */
+template <typename Sink, std::size_t N, std::size_t M>
+inline void write_record(Sink &sink,
+                         const char (&start)[N],
+                         const std::array<std::uint8_t, M> &fields,
+                         const std::uint8_t *data,
+                         std::size_t size,
+                         bool ones_complement) {
+   sink.write(start, N - 1);
+   const auto sum = write_record_bytes(sink, fields.data(), M) + write_record_bytes(sink, data, size);
+   const auto checksum = static_cast<std::uint8_t>(ones_complement ? ~sum : 0U - sum);
+   write_record_bytes(sink, &checksum, 1);
+   sink.put('\n');
+}
+
+//! Store the lowest `size` bytes of a value in big endian order
+inline void store_big_endian(std::uint8_t *out, std::uint64_t value, std::size_t size) {
+   for (std::size_t i = size; i != 0; --i) {
+      *out++ = static_cast<std::uint8_t>(value >> ((i - 1) * 8U));
+   }
+}
+
+//! Intel HEX records: 16-bit addresses, extended by the extended linear address records
+class intel_hex_format {
+public:
+   static const bool supports_header = false;
+
+   explicit intel_hex_format(const record_settings &settings)
+      : settings_{&settings} {
+      // Nothing to do here
+   }
+
+public:
+   static std::size_t max_record_size(const record_settings &) { return 255; }
+
+   //! Maximal number of bytes in a record at `address`, records don't cross 64 KiB segments
+   static std::size_t record_limit(std::uint64_t address) { return 0x10000U - (address & 0xFFFFU); }
+
+   template <typename Sink>
+   void prologue(Sink &) {
+      // Nothing to do here
+   }
+
+   template <typename Sink>
+   void data(Sink &sink, std::uint64_t address, const std::uint8_t *data, std::size_t size) {
+      if (update_segment(address)) {
+         std::array<std::uint8_t, 2> segment;
+         store_big_endian(segment.data(), segment_, 2);
+         write_record(sink, ":", std::array<std::uint8_t, 4>{{2, 0, 0, 4}}, segment.data(), segment.size(), false);
+      }
+
+      const std::array<std::uint8_t, 4> fields{{static_cast<std::uint8_t>(size),
+                                                static_cast<std::uint8_t>(address >> 8U),
+                                                static_cast<std::uint8_t>(address), 0}};
+      write_record(sink, ":", fields, data, size, false);
+   }
+
+   template <typename Sink>
+   void epilogue(Sink &sink) {
+      if (settings_->has_start_address) {
+         std::array<std::uint8_t, 4> start;
+         store_big_endian(start.data(), settings_->start_address, 4);
+         write_record(sink, ":", std::array<std::uint8_t, 4>{{4, 0, 0, 5}}, start.data(), start.size(), false);
+      }
+      sink.write(":00000001FF\n", 12);
+   }
+
+   std::size_t prologue_size() const { return 0; }
+
+   std::size_t data_size(std::uint64_t address, std::size_t size) {
+      // ":", byte count, address, type, data, checksum and a line end
+      return (update_segment(address) ? 16 : 0) + 12 + size * 2;
+   }
+
+   std::size_t epilogue_size() const { return (settings_->has_start_address ? 20 : 0) + 12; }
+
+private:
+   //! @return true if an extended linear address record is required for the address
+   bool update_segment(std::uint64_t address) {
+      const auto segment = address >> 16U;
+      if (segment == segment_) {
+         return false;
+      }
+      segment_ = segment;
+      return true;
+   }
+
+private:
+   const record_settings *settings_;
+
+   //! Upper 16 bits of the current address
+   std::uint64_t segment_{0};
+};
+
+//! Motorola S-records, the address width (S1, S2 or S3 records) is selected by the highest address
+class srec_format {
+public:
+   static const bool supports_header = true;
+
+   explicit srec_format(const record_settings &settings)
+      : settings_{&settings}
+      , address_size_{address_size(settings)} {
+      // Nothing to do here
+   }
+
+public:
+   static std::size_t address_size(const record_settings &settings) {
+      auto last = settings.base_address + (settings.total_size == 0 ? 0 : settings.total_size - 1);
+      if (settings.has_start_address && settings.start_address > last) {
+         last = settings.start_address;
+      }
+      return last <= 0xFFFFU ? 2 : (last <= 0xFFFFFFU ? 3 : 4);
+   }
+
+   //! The byte count field covers the address, data and checksum
+   static std::size_t max_record_size(const record_settings &settings) { return 254 - address_size(settings); }
+
+   //! S-records have no segment boundaries, the record size is only limited by the byte count field
+   static std::size_t record_limit(std::uint64_t) { return 0x100U; }
+
+   template <typename Sink>
+   void prologue(Sink &sink) {
+      const auto &header = settings_->header;
+      const std::array<std::uint8_t, 3> fields{{static_cast<std::uint8_t>(header.size() + 3), 0, 0}};
+      write_record(sink, "S0", fields, reinterpret_cast<const std::uint8_t *>(header.data()), header.size(), true);
+   }
+
+   template <typename Sink>
+   void data(Sink &sink, std::uint64_t address, const std::uint8_t *data, std::size_t size) {
+      ++records_;
+
+      std::array<std::uint8_t, 5> fields;
+      fields[0] = static_cast<std::uint8_t>(address_size_ + size + 1);
+      store_big_endian(fields.data() + 1, address, 4);
+
+      switch (address_size_) {
+         case 2:
+            return write_record(sink, "S1", shrink<3>(fields), data, size, true);
+         case 3:
+            return write_record(sink, "S2", shrink<4>(fields), data, size, true);
+         default:
+            return write_record(sink, "S3", fields, data, size, true);
+      }
+   }
+
+   template <typename Sink>
+   void epilogue(Sink &sink) {
+      // Number of data records
+      std::array<std::uint8_t, 5> fields;
+      if (records_ <= 0xFFFFFFU) {
+         const bool short_count = records_ <= 0xFFFFU;
+         fields[0] = short_count ? 3 : 4;
+         store_big_endian(fields.data() + 1, records_, 4);
+         if (short_count) {
+            write_record(sink, "S5", shrink<3>(fields), nullptr, 0, true);
+         } else {
+            write_record(sink, "S6", shrink<4>(fields), nullptr, 0, true);
+         }
+      }
+
+      // Termination with the start address
+      fields[0] = static_cast<std::uint8_t>(address_size_ + 1);
+      store_big_endian(fields.data() + 1, settings_->start_address, 4);
+      switch (address_size_) {
+         case 2:
+            return write_record(sink, "S9", shrink<3>(fields), nullptr, 0, true);
+         case 3:
+            return write_record(sink, "S8", shrink<4>(fields), nullptr, 0, true);
+         default:
+            return write_record(sink, "S7", fields, nullptr, 0, true);
+      }
+   }
+
+   std::size_t prologue_size() const { return 11 + settings_->header.size() * 2; }
+
+   std::size_t data_size(std::uint64_t, std::size_t size) {
+      ++records_;
+
+      // "S" and the type, byte count, address, data, checksum and a line end
+      return 7 + (address_size_ + size) * 2;
+   }
+
+   std::size_t epilogue_size() const {
+      const std::size_t count = records_ <= 0xFFFFU ? 11 : (records_ <= 0xFFFFFFU ? 13 : 0);
+      return count + 7 + address_size_ * 2;
+   }
+
+private:
+   //! Byte count and the lowest bytes of a 32-bit address
+   template <std::size_t N>
+   static std::array<std::uint8_t, N> shrink(const std::array<std::uint8_t, 5> &fields) {
+      std::array<std::uint8_t, N> result;
+      result[0] = fields[0];
+      std::memcpy(result.data() + 1, fields.data() + 5 - (N - 1), N - 1);
+      return result;
+   }
+
+private:
+   const record_settings *settings_;
+   std::size_t address_size_;
+   std::size_t records_{0};
+};
+
+} // namespace detail
+
+////////////////////////////////////////////////////////////////////////////////
+/// Class: record_writer
+////////////////////////////////////////////////////////////////////////////////
+//! Helper class for writing iterator ranges as Intel HEX or S-record files.
+template <typename Iterator, typename Format>
+class record_writer {
+private:
+   using iterator_t = Iterator;
+   using iterator_value_t = typename std::iterator_traits<iterator_t>::value_type;
+   using value_t = typename std::remove_cv<typename std::remove_reference<iterator_value_t>::type>::type;
+
+   static_assert(std::is_integral<value_t>::value || std::is_standard_layout<value_t>::value,
+                 "Iterator::value_type should either be an integral type or a POD type");
+
+   using self_t = record_writer<Iterator, Format>;
+
+public:
+   /**
+    * Constructor
+    * @param begin Range begin
+    * @param end Range end
+    * @param base_address Address of the first byte
+    * @param record_size Maximal number of data bytes in a single record
+    * @throw std::invalid_argument If the record size is not supported by the format, or the range doesn't fit into
+    *                              the 32-bit address space
+    */
+   record_writer(iterator_t begin, iterator_t end, std::uint32_t base_address, std::size_t record_size)
+      : begin_{begin}
+      , end_{end}
+      , settings_{base_address, static_cast<std::size_t>(std::distance(begin, end)) * sizeof(value_t), record_size} {
+      if (settings_.base_address + settings_.total_size > 0x100000000ULL) {
+         throw std::invalid_argument{"The range doesn't fit into the 32-bit address space"};
+      }
+      check_record_size();
+   }
+
+public:
+   /**
+    * Add a start address record (start linear address for Intel HEX, termination record address for S-records).
+    * @param address Start address
+    * @return This writer
+    */
+   self_t &start_address(std::uint32_t address) {
+      settings_.has_start_address = true;
+      settings_.start_address = address;
+      check_record_size();
+      return *this;
+   }
+
+   /**
+    * Set the S0 header record contents, available for S-records only.
+    * @param text Header, up to 252 characters
+    * @return This writer
+    */
+   self_t &header(std::string text) {
+      static_assert(Format::supports_header, "Header records are not supported by this format");
+      if (text.size() > 252) {
+         throw std::invalid_argument{"Header records are limited to 252 characters"};
+      }
+      settings_.header = std::move(text);
+      return *this;
+   }
+
+   /**
+    * Append the records to a string, reusing the string capacity.
+    * The required space is calculated upfront, so the string is resized at most once.
+    * @param out Output string
+    */
+   template <typename Traits, typename Allocator>
+   void append_to(std::basic_string<char, Traits, Allocator> &out) const {
+      const detail::stats_recorder recorder{settings_.total_size};
+
+      const auto offset = out.size();
+      const auto capacity = out.capacity();
+      const auto size = formatted_size();
+      out.resize(offset + size);
+
+      detail::pointer_sink sink{&out[offset]};
+      print_all(sink);
+
+      recorder.finish([size] { return size; }, out.capacity() != capacity ? 1 : 0);
+   }
+
+   /**
+    * Print the records into a custom sink, @see iterator_hex_writer::print_to for the sink requirements.
+    * @param sink Output sink
+    */
+   template <typename Sink>
+   void print_to(Sink &sink) const {
+      const detail::stats_recorder recorder{settings_.total_size};
+      print_all(sink);
+      recorder.finish([this] { return formatted_size(); });
+   }
+
+   /**
+    * Calculate the exact number of characters produced by this writer.
+    * @return Number of characters in all records.
+    */
+   std::size_t formatted_size() const {
+      Format format{settings_};
+
+      std::size_t result = format.prologue_size();
+      auto address = settings_.base_address;
+      for (auto remaining = settings_.total_size; remaining != 0;) {
+         const auto length = record_length(address, remaining);
+         result += format.data_size(address, length);
+         address += length;
+         remaining -= length;
+      }
+      return result + format.epilogue_size();
+   }
+
+public:
+   template <typename OIterator, typename OFormat>
+   friend std::ostream &operator<<(std::ostream &os, const record_writer<OIterator, OFormat> &v);
+
+private:
+   void check_record_size() const {
+      if (settings_.record_size == 0 || settings_.record_size > Format::max_record_size(settings_)) {
+         throw std::invalid_argument{"Unsupported record size: " + std::to_string(settings_.record_size)};
+      }
+   }
+
+   std::size_t record_length(std::uint64_t address, std::size_t remaining) const {
+      auto result = settings_.record_size < remaining ? settings_.record_size : remaining;
+      const auto limit = Format::record_limit(address);
+      return result < limit ? result : limit;
+   }
+
+   template <typename Sink>
+   void print_all(Sink &sink) const {
+      Format format{settings_};
+      format.prologue(sink);
+
+      // Records, spanning multiple blocks, are collected here
+      std::array<std::uint8_t, 256> pending;
+      std::size_t pending_size = 0;
+
+      auto address = settings_.base_address;
+      auto remaining = settings_.total_size;
+      detail::for_each_block(begin_, end_, [&](const std::uint8_t *data, std::size_t size) {
+         while (size != 0) {
+            const auto length = record_length(address, remaining);
+            if (pending_size == 0 && size >= length) {
+               format.data(sink, address, data, length);
+               data += length;
+               size -= length;
+            } else {
+               const auto count = length - pending_size < size ? length - pending_size : size;
+               std::memcpy(pending.data() + pending_size, data, count);
+               pending_size += count;
+               data += count;
+               size -= count;
+
+               if (pending_size != length) {
+                  continue;
+               }
+               format.data(sink, address, pending.data(), length);
+               pending_size = 0;
+            }
+
+            address += length;
+            remaining -= length;
+         }
+      });
+
+      format.epilogue(sink);
+   }
+
+   void do_print(std::ostream &os) const {
+      const detail::stats_recorder recorder{settings_.total_size};
+
+      detail::stream_sink sink{os};
+      print_all(sink);
+      sink.flush();
+
+      recorder.finish([this] { return formatted_size(); });
+   }
+
+private:
+   iterator_t begin_;
+   iterator_t end_;
+   detail::record_settings settings_;
+};
+
+template <typename Iterator, typename Format>
+std::ostream &operator<<(std::ostream &os, const record_writer<Iterator, Format> &v) {
+   v.do_print(os);
+   return os;
+}
+
+template <typename Iterator>
+using intel_hex_writer = record_writer<Iterator, detail::intel_hex_format>;
+
+template <typename Iterator>
+using srec_writer = record_writer<Iterator, detail::srec_format>;
+
+/**
+ * Construct a streamable object for writing a collection of POD-objects as Intel HEX records.
+ * Extended linear address records are added whenever the upper 16 address bits change.
+ *
+ * @example std::cout << shp::intel_hex(image, 0x08000000).start_address(0x08000131);
+ *
+ * @tparam ContainerT Container type.
+ * @param cont Container to construct a streamable object for.
+ * @param base_address Address of the first byte.
+ * @param record_size Maximal number of data bytes per record, up to 255.
+ * @return A streamable object.
+ */
+template <typename ContainerT>
+inline typename std::enable_if<is_container<ContainerT>::value
+                                  && std::is_standard_layout<typename is_container<ContainerT>::element_type>::value,
+                               intel_hex_writer<decltype(std::cbegin(std::declval<ContainerT>()))>>::type
+intel_hex(const ContainerT &cont, std::uint32_t base_address = 0, std::size_t record_size = 16) {
+   return intel_hex_writer<decltype(std::cbegin(cont))>{std::cbegin(cont), std::cend(cont), base_address,
+                                                        record_size};
+}
+
+/**
+ * Construct a streamable object for writing a collection of POD-objects as Motorola S-records.
+ * The output consists of a header record, data records, a record count and a termination record. The address width
+ * (S1/S9, S2/S8 or S3/S7) is selected by the highest address.
+ *
+ * @example std::cout << shp::srec(image, 0x08000000).header("app");
+ *
+ * @tparam ContainerT Container type.
+ * @param cont Container to construct a streamable object for.
+ * @param base_address Address of the first byte.
+ * @param record_size Maximal number of data bytes per record, up to 250 for 32-bit addresses.
+ * @return A streamable object.
+ */
+template <typename ContainerT>
+inline typename std::enable_if<is_container<ContainerT>::value
+                                  && std::is_standard_layout<typename is_container<ContainerT>::element_type>::value,
+                               srec_writer<decltype(std::cbegin(std::declval<ContainerT>()))>>::type
+srec(const ContainerT &cont, std::uint32_t base_address = 0, std::size_t record_size = 16) {
+   return srec_writer<decltype(std::cbegin(cont))>{std::cbegin(cont), std::cend(cont), base_address, record_size};
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Parsers
+////////////////////////////////////////////////////////////////////////////////
+//! Block of consecutive bytes
+struct hex_segment {
+   std::uint32_t address;
+   std::vector<std::uint8_t> data;
+};
+
+//! Contents of an Intel HEX or S-record file
+struct hex_image {
+   //! Data in the file order, consecutive records are merged into a single segment
+   std::vector<hex_segment> segments;
+
+   bool has_start_address{false};
+   std::uint32_t start_address{0};
+
+   //! S0 record contents
+   std::string header;
+};
+
+namespace detail {
+
+//! Values of the HEX digits, 0xFF for all other characters
+inline const std::array<std::uint8_t, 256> &hex_values() {
+   static const std::array<std::uint8_t, 256> table = [] {
+      std::array<std::uint8_t, 256> result;
+      result.fill(0xFF);
+      for (int i = 0; i < 10; ++i) {
+         result['0' + i] = static_cast<std::uint8_t>(i);
+      }
+      for (int i = 0; i < 6; ++i) {
+         result['a' + i] = result['A' + i] = static_cast<std::uint8_t>(10 + i);
+      }
+      return result;
+   }();
+   return table;
+}
+
+//! Parser state, shared by the record formats
+class record_parser {
+public:
+   record_parser(const char *format, const char *data, std::size_t size)
+      : format_{format}
+      , values_{hex_values().data()}
+      , data_{data}
+      , end_{data + size} {
+      // Nothing to do here
+   }
+
+public:
+   //! Get the next non-empty line, @return false at the end of the input
+   bool next_line(const char *&line, std::size_t &length) {
+      while (data_ != end_) {
+         ++line_number_;
+
+         auto last = static_cast<const char *>(std::memchr(data_, '\n', static_cast<std::size_t>(end_ - data_)));
+         last = last == nullptr ? end_ : last;
+
+         line = data_;
+         length = static_cast<std::size_t>(last - data_);
+         data_ = last == end_ ? end_ : last + 1;
+
+         if (length != 0 && line[length - 1] == '\r') {
+            --length;
+         }
+         if (length != 0) {
+            return true;
+         }
+      }
+      return false;
+   }
+
+   //! Decode HEX digits into bytes, @return Sum of the bytes
+   unsigned decode(const char *text, std::uint8_t *out, std::size_t size) const {
+      unsigned sum = 0;
+      for (std::size_t i = 0; i < size; ++i, text += 2) {
+         const auto high = values_[static_cast<unsigned char>(text[0])];
+         const auto low = values_[static_cast<unsigned char>(text[1])];
+         if ((high | low) > 0x0FU) {
+            fail("invalid HEX digit");
+         }
+         out[i] = static_cast<std::uint8_t>(high * 16 + low);
+         sum += out[i];
+      }
+      return sum;
+   }
+
+   //! Get the storage for data bytes at the address, merging consecutive records
+   static std::uint8_t *add_data(hex_image &image, std::uint64_t address, std::size_t size) {
+      auto &segments = image.segments;
+      if (segments.empty() || segments.back().address + segments.back().data.size() != address) {
+         segments.push_back(hex_segment{static_cast<std::uint32_t>(address), {}});
+      }
+
+      auto &data = segments.back().data;
+      const auto offset = data.size();
+      data.resize(offset + size);
+      return data.data() + offset;
+   }
+
+   [[noreturn]] void fail(const char *what) const {
+      throw std::invalid_argument{std::string{format_} + " line " + std::to_string(line_number_) + ": " + what};
+   }
+
+private:
+   const char *format_;
+   const std::uint8_t *values_;
+   const char *data_;
+   const char *end_;
+   std::size_t line_number_{0};
+};
+
+} // namespace detail
+
+/**
+ * Parse an Intel HEX file.
+ *
+ * @param data File contents.
+ * @param size File size.
+ * @return File contents.
+ * @throw std::invalid_argument If the file is malformed, the message contains the line number.
+ */
+inline hex_image parse_intel_hex(const char *data, std::size_t size) {
+   detail::record_parser parser{"Intel HEX", data, size};
+
+   hex_image result;
+   std::uint64_t segment = 0;
+
+   const char *line = nullptr;
+   std::size_t length = 0;
+   while (parser.next_line(line, length)) {
+      if (line[0] != ':') {
+         parser.fail("records should start with ':'");
+      }
+
+      std::array<std::uint8_t, 4> fields;
+      if (length < 11) {
+         parser.fail("record is too short");
+      }
+
+      auto sum = parser.decode(line + 1, fields.data(), fields.size());
+      const std::size_t count = fields[0];
+      if (length != 11 + count * 2) {
+         parser.fail("record length doesn't match the byte count");
+      }
+
+      const std::uint64_t address = fields[1] * 256U + fields[2];
+      const auto type = fields[3];
+      std::array<std::uint8_t, 255> value;
+
+      switch (type) {
+         case 0:
+            if (count != 0) {
+               sum += parser.decode(line + 9, detail::record_parser::add_data(result, segment + address, count), count);
+            }
+            break;
+
+         case 1:
+            break;
+
+         case 2:
+         case 4:
+            if (count != 2) {
+               parser.fail("invalid extended address record");
+            }
+            sum += parser.decode(line + 9, value.data(), count);
+            segment = static_cast<std::uint64_t>(value[0] * 256U + value[1]) << (type == 2 ? 4U : 16U);
+            break;
+
+         case 3:
+         case 5:
+            if (count != 4) {
+               parser.fail("invalid start address record");
+            }
+            sum += parser.decode(line + 9, value.data(), count);
+            result.has_start_address = true;
+            if (type == 3) {
+               // CS:IP
+               result.start_address = static_cast<std::uint32_t>((value[0] * 256U + value[1]) * 16U + value[2] * 256U
+                                                                 + value[3]);
+            } else {
+               result.start_address = static_cast<std::uint32_t>(value[0]) << 24U | value[1] << 16U
+                                    | value[2] << 8U | value[3];
+            }
+            break;
+
+         default:
+            parser.fail("unsupported record type");
+      }
+
+      std::uint8_t checksum = 0;
+      sum += parser.decode(line + 9 + count * 2, &checksum, 1);
+      if ((sum & 0xFFU) != 0) {
+         parser.fail("checksum mismatch");
+      }
+
+      if (type == 1) {
+         // End of file
+         break;
+      }
+   }
+   return result;
+}
+
+//! Parse an Intel HEX file, @see parse_intel_hex(const char *, std::size_t)
+inline hex_image parse_intel_hex(const std::string &text) {
+   return parse_intel_hex(text.data(), text.size());
+}
+
+/**
+ * Parse a Motorola S-record file.
+ *
+ * @param data File contents.
+ * @param size File size.
+ * @return File contents, the termination record address is reported as the start address.
+ * @throw std::invalid_argument If the file is malformed, the message contains the line number.
+ */
+inline hex_image parse_srec(const char *data, std::size_t size) {
+   detail::record_parser parser{"S-record", data, size};
+
+   // Address sizes by the record type, 0 for the reserved types
+   static const std::size_t address_sizes[] = {2, 2, 3, 4, 0, 2, 3, 4, 3, 2};
+
+   hex_image result;
+
+   const char *line = nullptr;
+   std::size_t length = 0;
+   while (parser.next_line(line, length)) {
+      if (length < 4 || line[0] != 'S' || line[1] < '0' || line[1] > '9') {
+         parser.fail("records should start with 'S' and the record type");
+      }
+
+      const auto type = line[1] - '0';
+      const auto address_size = address_sizes[type];
+      if (address_size == 0) {
+         parser.fail("unsupported record type");
+      }
+
+      std::uint8_t count = 0;
+      auto sum = parser.decode(line + 2, &count, 1);
+      if (length != 4 + count * 2U || count < address_size + 1) {
+         parser.fail("record length doesn't match the byte count");
+      }
+
+      std::array<std::uint8_t, 4> address_bytes;
+      sum += parser.decode(line + 4, address_bytes.data(), address_size);
+
+      std::uint64_t address = 0;
+      for (std::size_t i = 0; i < address_size; ++i) {
+         address = address * 256U + address_bytes[i];
+      }
+
+      const auto text = line + 4 + address_size * 2;
+      const std::size_t data_size = count - address_size - 1;
+
+      switch (type) {
+         case 0: {
+            result.header.resize(data_size);
+            sum += parser.decode(text, reinterpret_cast<std::uint8_t *>(&result.header[0]), data_size);
+            break;
+         }
+
+         case 1:
+         case 2:
+         case 3:
+            if (data_size != 0) {
+               sum += parser.decode(text, detail::record_parser::add_data(result, address, data_size), data_size);
+            }
+            break;
+
+         case 5:
+         case 6:
+            // Record count, not needed for the parsing
+            break;
+
+         default:
+            result.has_start_address = true;
+            result.start_address = static_cast<std::uint32_t>(address);
+            break;
+      }
+
+      if (data_size != 0 && (type == 5 || type > 6)) {
+         parser.fail("unexpected data in a count or termination record");
+      }
+
+      std::uint8_t checksum = 0;
+      sum += parser.decode(text + data_size * 2, &checksum, 1);
+      if ((sum & 0xFFU) != 0xFFU) {
+         parser.fail("checksum mismatch");
+      }
+
+      if (type > 6) {
+         // Termination record
+         break;
+      }
+   }
+   return result;
+}
+
+//! Parse a Motorola S-record file, @see parse_srec(const char *, std::size_t)
+inline hex_image parse_srec(const std::string &text) {
+   return parse_srec(text.data(), text.size());
+}
+
+} // namespace shp
+
+#endif /* SIMPLE_HEX_PRINTER_INCLUDE_SHP_HEX_RECORDS_H */
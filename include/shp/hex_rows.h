@@ -0,0 +1,287 @@
+/**
+ * @file   hex_rows.h
+ * @author Dennis Sitelew
+ * @date   Oct. 18, 2026
+ *
+ * Random-access views over the rows of HEX dumps.
+ */
+#ifndef SIMPLE_HEX_PRINTER_INCLUDE_SHP_HEX_ROWS_H
+#define SIMPLE_HEX_PRINTER_INCLUDE_SHP_HEX_ROWS_H
+
+#include <shp/container_traits.h>
+#include <shp/hex_dump.h>
+
+#include <cstddef>
+#include <iterator>
+#include <string>
+#include <type_traits>
+
+namespace shp {
+
+template <typename Iterator,
+          typename WithOffsets,
+          typename WithNibbleSeparation,
+          typename RowWidthValue,
+          typename WithASCII,
+          typename InUpperCase,
+          typename WithHighlight>
+class hex_match_writer;
+
+////////////////////////////////////////////////////////////////////////////////
+/// Class: hex_row_view
+////////////////////////////////////////////////////////////////////////////////
+/**
+ * Random-access view over the rows of a HEX dump.
+ *
+ * Every row is rendered on demand exactly as iterator_hex_writer would print it, including the offset width of the
+ * whole range, but without the row separator. For random-access ranges row(i) costs the same for every row, for
+ * other ranges the rows are produced by an input iterator.
+ */
+template <typename Iterator,
+          typename WithOffsets = PrintOffsets,
+          typename WithNibbleSeparation = SeparateNibbles,
+          typename RowWidthValue = RowWidth<16>,
+          typename WithASCII = PrintASCII,
+          typename InUpperCase = UpperCase>
+class hex_row_view {
+private:
+   static_assert(!std::is_same<RowWidthValue, SingleRow>::value, "Row view requires a fixed row width");
+
+   using writer_t =
+      iterator_hex_writer<Iterator, WithOffsets, WithNibbleSeparation, RowWidthValue, WithASCII, InUpperCase>;
+   using print_state = typename writer_t::print_state;
+   using value_t = typename writer_t::value_t;
+
+   using iterator_t = Iterator;
+
+   static const std::size_t row_width = RowWidthValue::value;
+   static const bool random_access =
+      std::is_base_of<std::random_access_iterator_tag,
+                      typename std::iterator_traits<iterator_t>::iterator_category>::value;
+
+public:
+   //! Input iterator over the rows, dereferencing renders the current row by value
+   class iterator {
+   public:
+      using iterator_category = std::input_iterator_tag;
+      using value_type = std::string;
+      using difference_type = std::ptrdiff_t;
+      using pointer = void;
+      using reference = std::string;
+
+   public:
+      iterator() = default;
+
+   private:
+      iterator(const hex_row_view *view, iterator_t it, std::size_t index)
+         : view_{view}
+         , it_{it}
+         , index_{index} {
+         // Nothing to do here
+      }
+
+   public:
+      std::string operator*() const {
+         std::string result;
+         append_to(result);
+         return result;
+      }
+
+      iterator &operator++() {
+         if (index_ + 1 >= view_->size()) {
+            // Don't advance past the range end for a partial last row
+            it_ = view_->end_;
+            skip_ = 0;
+         } else {
+            const auto bytes = skip_ + row_width;
+            std::advance(it_, static_cast<std::ptrdiff_t>(bytes / sizeof(value_t)));
+            skip_ = bytes % sizeof(value_t);
+         }
+         ++index_;
+         return *this;
+      }
+
+      iterator operator++(int) {
+         auto result = *this;
+         ++*this;
+         return result;
+      }
+
+      bool operator==(const iterator &o) const { return index_ == o.index_; }
+      bool operator!=(const iterator &o) const { return !(*this == o); }
+
+      //! Row index
+      std::size_t index() const { return index_; }
+
+      //! Append the current row to a string
+      template <typename Traits, typename Allocator>
+      void append_to(std::basic_string<char, Traits, Allocator> &out) const {
+         view_->append_at(out, it_, skip_, index_);
+      }
+
+      //! Print the current row into a sink, see iterator_hex_writer::print_to for the sink requirements
+      template <typename Sink>
+      void print_to(Sink &sink) const {
+         view_->print_at(sink, it_, skip_, index_);
+      }
+
+   private:
+      friend class hex_row_view;
+
+      const hex_row_view *view_{nullptr};
+      iterator_t it_{};
+
+      //! Number of leading bytes of *it_, belonging to the previous row
+      std::size_t skip_{0};
+
+      std::size_t index_{0};
+   };
+
+public:
+   hex_row_view(iterator_t begin, iterator_t end)
+      : begin_{begin}
+      , end_{end}
+      , total_size_{static_cast<std::size_t>(std::distance(begin, end)) * sizeof(value_t)}
+      , address_width_{writer_t::with_offsets ? print_state::get_address_width(total_size_) : 0} {
+      // Nothing to do here
+   }
+
+public:
+   //! Number of rows
+   std::size_t size() const { return (total_size_ + row_width - 1) / row_width; }
+
+   bool empty() const { return total_size_ == 0; }
+
+   iterator begin() const { return iterator{this, begin_, 0}; }
+   iterator end() const { return iterator{this, end_, size()}; }
+
+   /**
+    * Render a single row, available for random-access ranges only.
+    * @param index Row index, should be less than size()
+    * @return Row contents without the row separator
+    */
+   std::string row(std::size_t index) const {
+      std::string result;
+      append_row(index, result);
+      return result;
+   }
+
+   //! Append a single row to a string, see row()
+   template <typename Traits, typename Allocator>
+   void append_row(std::size_t index, std::basic_string<char, Traits, Allocator> &out) const {
+      std::size_t skip = 0;
+      const auto it = seek(index, skip);
+      append_at(out, it, skip, index);
+   }
+
+   //! Print a single row into a sink, see row() and iterator_hex_writer::print_to
+   template <typename Sink>
+   void print_row(std::size_t index, Sink &sink) const {
+      std::size_t skip = 0;
+      const auto it = seek(index, skip);
+      print_at(sink, it, skip, index);
+   }
+
+   //! Exact number of characters in a row
+   std::size_t row_size(std::size_t index) const { return writer_t::formatted_size(row_bytes(index), address_width_); }
+
+private:
+   template <typename, typename, typename, typename, typename, typename, typename>
+   friend class hex_match_writer;
+
+   iterator_t seek(std::size_t index, std::size_t &skip) const {
+      static_assert(random_access, "Accessing rows by index requires a random-access range, use the iterators instead");
+
+      const auto offset = index * row_width;
+      skip = offset % sizeof(value_t);
+      return begin_ + static_cast<std::ptrdiff_t>(offset / sizeof(value_t));
+   }
+
+   std::size_t row_bytes(std::size_t index) const {
+      const auto rest = total_size_ - index * row_width;
+      return rest < row_width ? rest : row_width;
+   }
+
+   template <typename Sink>
+   void print_at(Sink &sink, iterator_t it, std::size_t skip, std::size_t index) const {
+      const auto count = row_bytes(index);
+      const detail::stats_recorder recorder{count};
+
+      print_state ps{it, end_, total_size_, index * row_width};
+      writer_t::print_row(sink, ps, skip, count);
+
+      recorder.finish([this, count] { return writer_t::formatted_size(count, address_width_); });
+   }
+
+   template <typename Traits, typename Allocator>
+   void append_at(std::basic_string<char, Traits, Allocator> &out,
+                  iterator_t it,
+                  std::size_t skip,
+                  std::size_t index) const {
+      const auto count = row_bytes(index);
+      const detail::stats_recorder recorder{count};
+
+      const auto offset = out.size();
+      const auto capacity = out.capacity();
+      const auto size = writer_t::formatted_size(count, address_width_);
+      out.resize(offset + size);
+
+      print_state ps{it, end_, total_size_, index * row_width};
+      detail::pointer_sink sink{&out[offset]};
+      writer_t::print_row(sink, ps, skip, count);
+
+      recorder.finish([size] { return size; }, out.capacity() != capacity ? 1 : 0);
+   }
+
+private:
+   iterator_t begin_;
+   iterator_t end_;
+
+   //! Total number of bytes in the range
+   std::size_t total_size_;
+
+   //! Number of offset digits, shared by all rows
+   std::size_t address_width_;
+};
+
+/**
+ * Construct a row view over a collection of POD-objects, for rendering the dump rows independently.
+ *
+ * @example auto rows = shp::hex_rows(capture); for (std::size_t i = first; i < first + 40; ++i) page += rows.row(i);
+ *
+ * @tparam ContainerT Container type.
+ * @tparam WithOffsets Controls whether the row offsets should be printed out or not.
+ * @tparam WithNibbleSeparation Controls whether nibbles should be separated or not.
+ * @tparam RowWidthValue Number of bytes in a single row.
+ * @tparam WithASCII Controls whether ASCII values should be printed out or not.
+ * @tparam InUpperCase Controls whether HEX values should be printed out in upper-case or not.
+ * @param cont Container to construct a view for, should outlive the view.
+ * @return A row view.
+ */
+template <typename ContainerT,
+          typename WithOffsets = PrintOffsets,
+          typename WithNibbleSeparation = SeparateNibbles,
+          typename RowWidthValue = RowWidth<16>,
+          typename WithASCII = PrintASCII,
+          typename InUpperCase = UpperCase>
+inline typename std::enable_if<is_container<ContainerT>::value
+                                  && std::is_standard_layout<typename is_container<ContainerT>::element_type>::value,
+                               hex_row_view<decltype(std::cbegin(std::declval<ContainerT>())),
+                                            WithOffsets,
+                                            WithNibbleSeparation,
+                                            RowWidthValue,
+                                            WithASCII,
+                                            InUpperCase>>::type
+hex_rows(const ContainerT &cont,
+         const WithOffsets = WithOffsets{},
+         const WithNibbleSeparation = WithNibbleSeparation{},
+         const RowWidthValue = RowWidthValue{},
+         const WithASCII = WithASCII{},
+         const InUpperCase = InUpperCase{}) {
+   return hex_row_view<decltype(std::cbegin(cont)), WithOffsets, WithNibbleSeparation, RowWidthValue, WithASCII,
+                       InUpperCase>{std::cbegin(cont), std::cend(cont)};
+}
+
+} // namespace shp
+
+#endif /* SIMPLE_HEX_PRINTER_INCLUDE_SHP_HEX_ROWS_H */
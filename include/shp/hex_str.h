@@ -0,0 +1,608 @@
+/**
+ * @file   hex_str.h
+ * @author Dennis Sitelew
+ * @date   Oct. 18, 2026
+ *
+ * HEX strings: formatting into new and existing strings.
+ */
+#ifndef SIMPLE_HEX_PRINTER_INCLUDE_SHP_HEX_STR_H
+#define SIMPLE_HEX_PRINTER_INCLUDE_SHP_HEX_STR_H
+
+#include <shp/core.h>
+#include <shp/hex_dump.h>
+
+#include <cstddef>
+#include <initializer_list>
+#include <memory>
+#include <string>
+#include <type_traits>
+
+#if SHP_CPLUSPLUS >= 201703L
+#if defined(__has_include)
+#if __has_include(<memory_resource>)
+#include <memory_resource>
+#endif
+#endif
+#endif
+
+namespace shp {
+
+namespace detail {
+
+//! Sink appending to a string, used when the output size is not known upfront.
+template <typename Traits, typename Allocator>
+class basic_string_sink {
+public:
+   explicit basic_string_sink(std::basic_string<char, Traits, Allocator> &out)
+      : out_{&out} {
+      // Nothing to do here
+   }
+
+public:
+   void put(char c) { out_->push_back(c); }
+
+   void write(const char *data, std::size_t size) { out_->append(data, size); }
+
+   //! Get a buffer for writing up to `size` characters directly, the written characters are marked with commit()
+   char *acquire(std::size_t size) {
+      const auto offset = out_->size();
+      out_->resize(offset + size);
+      return &(*out_)[offset];
+   }
+
+   //! Mark all the characters up to `end` as written
+   void commit(char *end) { out_->resize(static_cast<std::size_t>(end - &(*out_)[0])); }
+
+private:
+   std::basic_string<char, Traits, Allocator> *out_;
+};
+
+using string_sink = basic_string_sink<std::char_traits<char>, std::allocator<char>>;
+
+} // namespace detail
+
+////////////////////////////////////////////////////////////////////////////////
+/// HEX-Strings from objects
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Convert an integral type to a HEX-string.
+ *
+ * @example auto str = shp::hex_str(0xBEEF);
+ *
+ * @tparam T Integral type.
+ * @tparam WithPrefix Controls whether the 0x prefix should be printed or not.
+ * @tparam DoFill Controls whether the printed out value should be filled (padded) with zeroes or not.
+ * @tparam InUpperCase Controls whether the HEX value should be printed in upper case or not.
+ * @param value Value to construct a streamable object from.
+ * @return A HEX string representation of a value.
+ */
+template <typename T, typename WithPrefix = Prefix, typename DoFill = Fill, typename InUpperCase = UpperCase>
+inline typename std::enable_if<detail::is_integer<T>::value, std::string>::type
+hex_str(const T &value, const WithPrefix = WithPrefix{}, const DoFill = DoFill{}, const InUpperCase = InUpperCase{}) {
+   std::string result;
+   integral_hex_writer<T, WithPrefix, DoFill, InUpperCase>{value}.append_to(result);
+   return result;
+}
+
+/**
+ * Convert an collection of POD-objects into a HEX-string.
+ *
+ * @example struct { int a; int b; } q[2] = {{1, 2}, {3, 4}}; auto str = shp::hex_str(q);
+ *
+ * @tparam ContainerT Container type.
+ * @tparam WithOffsets Controls whether the row offsets should be printed out or not.
+ * @tparam WithNibbleSeparation Controls whether nibbles should be separated or not.
+ * @tparam RowWidthValue Maximal of a single row (in bytes).
+ * @tparam WithASCII Controls whether ASCII values should be printed out or not.
+ * @tparam InUpperCase Controls whether HEX values should be printed out in upper-case or not.
+ * @param cont Container to construct a streamable object for.
+ * @return A HEX string representation of the collection.
+ */
+template <typename ContainerT,
+          typename WithOffsets = PrintOffsets,
+          typename WithNibbleSeparation = SeparateNibbles,
+          typename RowWidthValue = RowWidth<16>,
+          typename WithASCII = PrintASCII,
+          typename InUpperCase = UpperCase>
+inline typename std::enable_if<is_container<ContainerT>::value
+                                  && std::is_standard_layout<typename std::iterator_traits<
+                                     decltype(std::cbegin(std::declval<ContainerT>()))>::value_type>::value,
+                               std::string>::type
+hex_str(const ContainerT &cont,
+        const WithOffsets = WithOffsets{},
+        const WithNibbleSeparation = WithNibbleSeparation{},
+        const RowWidthValue = RowWidthValue{},
+        const WithASCII = WithASCII{},
+        const InUpperCase = InUpperCase{}) {
+   std::string result;
+   iterator_hex_writer<decltype(std::cbegin(cont)), WithOffsets, WithNibbleSeparation, RowWidthValue, WithASCII,
+                       InUpperCase>{std::cbegin(cont), std::cend(cont)}
+      .append_to(result);
+   return result;
+}
+
+template <typename ValueT,
+   typename WithOffsets = PrintOffsets,
+   typename WithNibbleSeparation = SeparateNibbles,
+   typename RowWidthValue = RowWidth<16>,
+   typename WithASCII = PrintASCII,
+   typename InUpperCase = UpperCase>
+inline typename std::enable_if<std::is_standard_layout<ValueT>::value, std::string>::type
+hex_str(std::initializer_list<ValueT> cont,
+        const WithOffsets = WithOffsets{},
+        const WithNibbleSeparation = WithNibbleSeparation{},
+        const RowWidthValue = RowWidthValue{},
+        const WithASCII = WithASCII{},
+        const InUpperCase = InUpperCase{}) {
+   std::string result;
+   iterator_hex_writer<decltype(std::cbegin(cont)), WithOffsets, WithNibbleSeparation, RowWidthValue, WithASCII,
+                       InUpperCase>{std::cbegin(cont), std::cend(cont)}
+      .append_to(result);
+   return result;
+}
+
+/**
+ * Convert an single POD-object into a HEX-string.
+ *
+ * @example struct { int a; int b; } q = {1, 2}; auto str = shp::hex_str(q);
+ *
+ * @tparam T Object type.
+ * @tparam WithOffsets Controls whether the row offsets should be printed out or not.
+ * @tparam WithNibbleSeparation Controls whether nibbles should be separated or not.
+ * @tparam RowWidthValue Maximal of a single row (in bytes).
+ * @tparam WithASCII Controls whether ASCII values should be printed out or not.
+ * @tparam InUpperCase Controls whether HEX values should be printed out in upper-case or not.
+ * @param cont Container to construct a streamable object for.
+ * @return A HEX string representation of the collection.
+ */
+template <typename T,
+          typename WithOffsets = PrintOffsets,
+          typename WithNibbleSeparation = SeparateNibbles,
+          typename RowWidthValue = RowWidth<16>,
+          typename WithASCII = PrintASCII,
+          typename InUpperCase = UpperCase>
+inline typename std::enable_if<
+   !is_container<T>::value && std::is_standard_layout<T>::value && !detail::is_integer<T>::value,
+   std::string>::type
+hex_str(const T &v,
+        const WithOffsets = WithOffsets{},
+        const WithNibbleSeparation = WithNibbleSeparation{},
+        const RowWidthValue = RowWidthValue{},
+        const WithASCII = WithASCII{},
+        const InUpperCase = InUpperCase{}) {
+   std::string result;
+   detail::make_object_writer<
+      detail::object_hex_writer<T, WithOffsets, WithNibbleSeparation, RowWidthValue, WithASCII, InUpperCase>>(v)
+      .append_to(result);
+   return result;
+}
+
+namespace detail {
+
+//! String allocator, constructed from an allocator of any type
+template <typename Allocator, typename = void>
+struct string_allocator {
+   using type = typename std::allocator_traits<Allocator>::template rebind_alloc<char>;
+
+   static type make(const Allocator &alloc) { return type(alloc); }
+};
+
+#if defined(__cpp_lib_memory_resource)
+//! Memory resources are wrapped into a polymorphic allocator
+template <typename Resource>
+struct string_allocator<Resource *,
+                        typename std::enable_if<std::is_base_of<std::pmr::memory_resource, Resource>::value>::type> {
+   using type = std::pmr::polymorphic_allocator<char>;
+
+   static type make(Resource *resource) { return type{resource}; }
+};
+#endif
+
+template <typename Allocator>
+using allocated_string = std::basic_string<char, std::char_traits<char>, typename string_allocator<Allocator>::type>;
+
+} // namespace detail
+
+/**
+ * Convert an integral type to a HEX-string, allocated with a custom allocator.
+ *
+ * @example auto str = shp::hex_str(std::allocator_arg, arena_allocator, 0xBEEF);
+ *
+ * @tparam Allocator Allocator type, or a std::pmr::memory_resource pointer (C++17), in which case a std::pmr::string
+ *                   is returned.
+ * @tparam T Integral type.
+ * @tparam WithPrefix Controls whether the 0x prefix should be printed or not.
+ * @tparam DoFill Controls whether the printed out value should be filled (padded) with zeroes or not.
+ * @tparam InUpperCase Controls whether the HEX value should be printed in upper case or not.
+ * @param alloc Allocator, used for the returned string.
+ * @param value Value to construct a streamable object from.
+ * @return A HEX string representation of a value.
+ */
+template <typename Allocator,
+          typename T,
+          typename WithPrefix = Prefix,
+          typename DoFill = Fill,
+          typename InUpperCase = UpperCase>
+inline typename std::enable_if<detail::is_integer<T>::value, detail::allocated_string<Allocator>>::type
+hex_str(std::allocator_arg_t,
+        const Allocator &alloc,
+        const T &value,
+        const WithPrefix = WithPrefix{},
+        const DoFill = DoFill{},
+        const InUpperCase = InUpperCase{}) {
+   detail::allocated_string<Allocator> result{detail::string_allocator<Allocator>::make(alloc)};
+   integral_hex_writer<T, WithPrefix, DoFill, InUpperCase>{value}.append_to(result);
+   return result;
+}
+
+/**
+ * Convert an collection of POD-objects into a HEX-string, allocated with a custom allocator.
+ *
+ * @example std::pmr::monotonic_buffer_resource arena; auto str = shp::hex_str(std::allocator_arg, &arena, packet);
+ *
+ * @tparam Allocator Allocator type, or a std::pmr::memory_resource pointer (C++17), in which case a std::pmr::string
+ *                   is returned.
+ * @tparam ContainerT Container type.
+ * @tparam WithOffsets Controls whether the row offsets should be printed out or not.
+ * @tparam WithNibbleSeparation Controls whether nibbles should be separated or not.
+ * @tparam RowWidthValue Maximal of a single row (in bytes).
+ * @tparam WithASCII Controls whether ASCII values should be printed out or not.
+ * @tparam InUpperCase Controls whether HEX values should be printed out in upper-case or not.
+ * @param alloc Allocator, used for the returned string.
+ * @param cont Container to construct a streamable object for.
+ * @return A HEX string representation of the collection.
+ */
+template <typename Allocator,
+          typename ContainerT,
+          typename WithOffsets = PrintOffsets,
+          typename WithNibbleSeparation = SeparateNibbles,
+          typename RowWidthValue = RowWidth<16>,
+          typename WithASCII = PrintASCII,
+          typename InUpperCase = UpperCase>
+inline typename std::enable_if<is_container<ContainerT>::value
+                                  && std::is_standard_layout<typename std::iterator_traits<
+                                     decltype(std::cbegin(std::declval<ContainerT>()))>::value_type>::value,
+                               detail::allocated_string<Allocator>>::type
+hex_str(std::allocator_arg_t,
+        const Allocator &alloc,
+        const ContainerT &cont,
+        const WithOffsets = WithOffsets{},
+        const WithNibbleSeparation = WithNibbleSeparation{},
+        const RowWidthValue = RowWidthValue{},
+        const WithASCII = WithASCII{},
+        const InUpperCase = InUpperCase{}) {
+   detail::allocated_string<Allocator> result{detail::string_allocator<Allocator>::make(alloc)};
+   iterator_hex_writer<decltype(std::cbegin(cont)), WithOffsets, WithNibbleSeparation, RowWidthValue, WithASCII,
+                       InUpperCase>{std::cbegin(cont), std::cend(cont)}
+      .append_to(result);
+   return result;
+}
+
+template <typename Allocator,
+          typename ValueT,
+          typename WithOffsets = PrintOffsets,
+          typename WithNibbleSeparation = SeparateNibbles,
+          typename RowWidthValue = RowWidth<16>,
+          typename WithASCII = PrintASCII,
+          typename InUpperCase = UpperCase>
+inline typename std::enable_if<std::is_standard_layout<ValueT>::value, detail::allocated_string<Allocator>>::type
+hex_str(std::allocator_arg_t,
+        const Allocator &alloc,
+        std::initializer_list<ValueT> cont,
+        const WithOffsets = WithOffsets{},
+        const WithNibbleSeparation = WithNibbleSeparation{},
+        const RowWidthValue = RowWidthValue{},
+        const WithASCII = WithASCII{},
+        const InUpperCase = InUpperCase{}) {
+   detail::allocated_string<Allocator> result{detail::string_allocator<Allocator>::make(alloc)};
+   iterator_hex_writer<decltype(std::cbegin(cont)), WithOffsets, WithNibbleSeparation, RowWidthValue, WithASCII,
+                       InUpperCase>{std::cbegin(cont), std::cend(cont)}
+      .append_to(result);
+   return result;
+}
+
+/**
+ * Convert an single POD-object into a HEX-string, allocated with a custom allocator.
+ *
+ * @example struct { int a; int b; } q = {1, 2}; auto str = shp::hex_str(std::allocator_arg, arena_allocator, q);
+ *
+ * @tparam Allocator Allocator type, or a std::pmr::memory_resource pointer (C++17), in which case a std::pmr::string
+ *                   is returned.
+ * @tparam T Object type.
+ * @tparam WithOffsets Controls whether the row offsets should be printed out or not.
+ * @tparam WithNibbleSeparation Controls whether nibbles should be separated or not.
+ * @tparam RowWidthValue Maximal of a single row (in bytes).
+ * @tparam WithASCII Controls whether ASCII values should be printed out or not.
+ * @tparam InUpperCase Controls whether HEX values should be printed out in upper-case or not.
+ * @param alloc Allocator, used for the returned string.
+ * @param v Object to construct a streamable object for.
+ * @return A HEX string representation of the object.
+ */
+template <typename Allocator,
+          typename T,
+          typename WithOffsets = PrintOffsets,
+          typename WithNibbleSeparation = SeparateNibbles,
+          typename RowWidthValue = RowWidth<16>,
+          typename WithASCII = PrintASCII,
+          typename InUpperCase = UpperCase>
+inline typename std::enable_if<
+   !is_container<T>::value && std::is_standard_layout<T>::value && !detail::is_integer<T>::value,
+   detail::allocated_string<Allocator>>::type
+hex_str(std::allocator_arg_t,
+        const Allocator &alloc,
+        const T &v,
+        const WithOffsets = WithOffsets{},
+        const WithNibbleSeparation = WithNibbleSeparation{},
+        const RowWidthValue = RowWidthValue{},
+        const WithASCII = WithASCII{},
+        const InUpperCase = InUpperCase{}) {
+   detail::allocated_string<Allocator> result{detail::string_allocator<Allocator>::make(alloc)};
+   detail::make_object_writer<
+      detail::object_hex_writer<T, WithOffsets, WithNibbleSeparation, RowWidthValue, WithASCII, InUpperCase>>(v)
+      .append_to(result);
+   return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// HEX-Strings into existing buffers
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Append an integral type in HEX to a string. No allocations are made if the string has enough capacity.
+ *
+ * @example std::string str{"value: "}; shp::append_hex(str, 0xBEEF);
+ *
+ * @tparam T Integral type.
+ * @tparam WithPrefix Controls whether the 0x prefix should be printed or not.
+ * @tparam DoFill Controls whether the printed out value should be filled (padded) with zeroes or not.
+ * @tparam InUpperCase Controls whether the HEX value should be printed in upper case or not.
+ * @param out String to append the HEX representation to.
+ * @param value Value to be appended.
+ */
+template <typename T,
+          typename WithPrefix = Prefix,
+          typename DoFill = Fill,
+          typename InUpperCase = UpperCase,
+          typename Traits,
+          typename Allocator>
+inline typename std::enable_if<detail::is_integer<T>::value>::type
+append_hex(std::basic_string<char, Traits, Allocator> &out,
+           const T &value,
+           const WithPrefix = WithPrefix{},
+           const DoFill = DoFill{},
+           const InUpperCase = InUpperCase{}) {
+   integral_hex_writer<T, WithPrefix, DoFill, InUpperCase>{value}.append_to(out);
+}
+
+/**
+ * Append a collection of POD-objects in HEX to a string. No allocations are made if the string has enough capacity.
+ *
+ * @example std::vector<std::uint8_t> v{1, 2, 3}; std::string str; shp::append_hex(str, v);
+ *
+ * @tparam ContainerT Container type.
+ * @tparam WithOffsets Controls whether the row offsets should be printed out or not.
+ * @tparam WithNibbleSeparation Controls whether nibbles should be separated or not.
+ * @tparam RowWidthValue Maximal of a single row (in bytes).
+ * @tparam WithASCII Controls whether ASCII values should be printed out or not.
+ * @tparam InUpperCase Controls whether HEX values should be printed out in upper-case or not.
+ * @param out String to append the HEX representation to.
+ * @param cont Container to be appended.
+ */
+template <typename ContainerT,
+          typename WithOffsets = PrintOffsets,
+          typename WithNibbleSeparation = SeparateNibbles,
+          typename RowWidthValue = RowWidth<16>,
+          typename WithASCII = PrintASCII,
+          typename InUpperCase = UpperCase,
+          typename Traits,
+          typename Allocator>
+inline typename std::enable_if<is_container<ContainerT>::value
+                               && std::is_standard_layout<typename std::iterator_traits<
+                                  decltype(std::cbegin(std::declval<ContainerT>()))>::value_type>::value>::type
+append_hex(std::basic_string<char, Traits, Allocator> &out,
+           const ContainerT &cont,
+           const WithOffsets = WithOffsets{},
+           const WithNibbleSeparation = WithNibbleSeparation{},
+           const RowWidthValue = RowWidthValue{},
+           const WithASCII = WithASCII{},
+           const InUpperCase = InUpperCase{}) {
+   iterator_hex_writer<decltype(std::cbegin(cont)), WithOffsets, WithNibbleSeparation, RowWidthValue, WithASCII,
+                       InUpperCase>{std::cbegin(cont), std::cend(cont)}
+      .append_to(out);
+}
+
+template <typename ValueT,
+          typename WithOffsets = PrintOffsets,
+          typename WithNibbleSeparation = SeparateNibbles,
+          typename RowWidthValue = RowWidth<16>,
+          typename WithASCII = PrintASCII,
+          typename InUpperCase = UpperCase,
+          typename Traits,
+          typename Allocator>
+inline typename std::enable_if<std::is_standard_layout<ValueT>::value>::type
+append_hex(std::basic_string<char, Traits, Allocator> &out,
+           std::initializer_list<ValueT> cont,
+           const WithOffsets = WithOffsets{},
+           const WithNibbleSeparation = WithNibbleSeparation{},
+           const RowWidthValue = RowWidthValue{},
+           const WithASCII = WithASCII{},
+           const InUpperCase = InUpperCase{}) {
+   iterator_hex_writer<decltype(std::cbegin(cont)), WithOffsets, WithNibbleSeparation, RowWidthValue, WithASCII,
+                       InUpperCase>{std::cbegin(cont), std::cend(cont)}
+      .append_to(out);
+}
+
+/**
+ * Append a single POD-object in HEX to a string. No allocations are made if the string has enough capacity.
+ *
+ * @example struct { int a; int b; } q = {1, 2}; std::string str; shp::append_hex(str, q);
+ *
+ * @tparam T Object type.
+ * @tparam WithOffsets Controls whether the row offsets should be printed out or not.
+ * @tparam WithNibbleSeparation Controls whether nibbles should be separated or not.
+ * @tparam RowWidthValue Maximal of a single row (in bytes).
+ * @tparam WithASCII Controls whether ASCII values should be printed out or not.
+ * @tparam InUpperCase Controls whether HEX values should be printed out in upper-case or not.
+ * @param out String to append the HEX representation to.
+ * @param v Object to be appended.
+ */
+template <typename T,
+          typename WithOffsets = PrintOffsets,
+          typename WithNibbleSeparation = SeparateNibbles,
+          typename RowWidthValue = RowWidth<16>,
+          typename WithASCII = PrintASCII,
+          typename InUpperCase = UpperCase,
+          typename Traits,
+          typename Allocator>
+inline typename std::enable_if<!is_container<T>::value && std::is_standard_layout<T>::value
+                               && !detail::is_integer<T>::value>::type
+append_hex(std::basic_string<char, Traits, Allocator> &out,
+           const T &v,
+           const WithOffsets = WithOffsets{},
+           const WithNibbleSeparation = WithNibbleSeparation{},
+           const RowWidthValue = RowWidthValue{},
+           const WithASCII = WithASCII{},
+           const InUpperCase = InUpperCase{}) {
+   detail::make_object_writer<
+      detail::object_hex_writer<T, WithOffsets, WithNibbleSeparation, RowWidthValue, WithASCII, InUpperCase>>(v)
+      .append_to(out);
+}
+
+/**
+ * Replace the string contents with the HEX representation of an integral value, reusing the string capacity.
+ *
+ * @example std::string str; shp::hex_str_into(str, 0xBEEF);
+ *
+ * @tparam T Integral type.
+ * @tparam WithPrefix Controls whether the 0x prefix should be printed or not.
+ * @tparam DoFill Controls whether the printed out value should be filled (padded) with zeroes or not.
+ * @tparam InUpperCase Controls whether the HEX value should be printed in upper case or not.
+ * @param out Output string.
+ * @param value Value to be converted.
+ */
+template <typename T,
+          typename WithPrefix = Prefix,
+          typename DoFill = Fill,
+          typename InUpperCase = UpperCase,
+          typename Traits,
+          typename Allocator>
+inline typename std::enable_if<detail::is_integer<T>::value>::type
+hex_str_into(std::basic_string<char, Traits, Allocator> &out,
+             const T &value,
+             const WithPrefix = WithPrefix{},
+             const DoFill = DoFill{},
+             const InUpperCase = InUpperCase{}) {
+   out.clear();
+   append_hex(out, value, WithPrefix{}, DoFill{}, InUpperCase{});
+}
+
+/**
+ * Replace the string contents with the HEX representation of a collection of POD-objects, reusing the string
+ * capacity.
+ *
+ * @example std::vector<std::uint8_t> v{1, 2, 3}; std::string str; shp::hex_str_into(str, v);
+ *
+ * @tparam ContainerT Container type.
+ * @tparam WithOffsets Controls whether the row offsets should be printed out or not.
+ * @tparam WithNibbleSeparation Controls whether nibbles should be separated or not.
+ * @tparam RowWidthValue Maximal of a single row (in bytes).
+ * @tparam WithASCII Controls whether ASCII values should be printed out or not.
+ * @tparam InUpperCase Controls whether HEX values should be printed out in upper-case or not.
+ * @param out Output string.
+ * @param cont Container to be converted.
+ */
+template <typename ContainerT,
+          typename WithOffsets = PrintOffsets,
+          typename WithNibbleSeparation = SeparateNibbles,
+          typename RowWidthValue = RowWidth<16>,
+          typename WithASCII = PrintASCII,
+          typename InUpperCase = UpperCase,
+          typename Traits,
+          typename Allocator>
+inline typename std::enable_if<is_container<ContainerT>::value
+                               && std::is_standard_layout<typename std::iterator_traits<
+                                  decltype(std::cbegin(std::declval<ContainerT>()))>::value_type>::value>::type
+hex_str_into(std::basic_string<char, Traits, Allocator> &out,
+             const ContainerT &cont,
+             const WithOffsets = WithOffsets{},
+             const WithNibbleSeparation = WithNibbleSeparation{},
+             const RowWidthValue = RowWidthValue{},
+             const WithASCII = WithASCII{},
+             const InUpperCase = InUpperCase{}) {
+   out.clear();
+   append_hex(out, cont, WithOffsets{}, WithNibbleSeparation{}, RowWidthValue{}, WithASCII{}, InUpperCase{});
+}
+
+template <typename ValueT,
+          typename WithOffsets = PrintOffsets,
+          typename WithNibbleSeparation = SeparateNibbles,
+          typename RowWidthValue = RowWidth<16>,
+          typename WithASCII = PrintASCII,
+          typename InUpperCase = UpperCase,
+          typename Traits,
+          typename Allocator>
+inline typename std::enable_if<std::is_standard_layout<ValueT>::value>::type
+hex_str_into(std::basic_string<char, Traits, Allocator> &out,
+             std::initializer_list<ValueT> cont,
+             const WithOffsets = WithOffsets{},
+             const WithNibbleSeparation = WithNibbleSeparation{},
+             const RowWidthValue = RowWidthValue{},
+             const WithASCII = WithASCII{},
+             const InUpperCase = InUpperCase{}) {
+   out.clear();
+   append_hex(out, cont, WithOffsets{}, WithNibbleSeparation{}, RowWidthValue{}, WithASCII{}, InUpperCase{});
+}
+
+/**
+ * Replace the string contents with the HEX representation of a single POD-object, reusing the string capacity.
+ *
+ * @example struct { int a; int b; } q = {1, 2}; std::string str; shp::hex_str_into(str, q);
+ *
+ * @tparam T Object type.
+ * @tparam WithOffsets Controls whether the row offsets should be printed out or not.
+ * @tparam WithNibbleSeparation Controls whether nibbles should be separated or not.
+ * @tparam RowWidthValue Maximal of a single row (in bytes).
+ * @tparam WithASCII Controls whether ASCII values should be printed out or not.
+ * @tparam InUpperCase Controls whether HEX values should be printed out in upper-case or not.
+ * @param out Output string.
+ * @param v Object to be converted.
+ */
+template <typename T,
+          typename WithOffsets = PrintOffsets,
+          typename WithNibbleSeparation = SeparateNibbles,
+          typename RowWidthValue = RowWidth<16>,
+          typename WithASCII = PrintASCII,
+          typename InUpperCase = UpperCase,
+          typename Traits,
+          typename Allocator>
+inline typename std::enable_if<!is_container<T>::value && std::is_standard_layout<T>::value
+                               && !detail::is_integer<T>::value>::type
+hex_str_into(std::basic_string<char, Traits, Allocator> &out,
+             const T &v,
+             const WithOffsets = WithOffsets{},
+             const WithNibbleSeparation = WithNibbleSeparation{},
+             const RowWidthValue = RowWidthValue{},
+             const WithASCII = WithASCII{},
+             const InUpperCase = InUpperCase{}) {
+   out.clear();
+   append_hex(out, v, WithOffsets{}, WithNibbleSeparation{}, RowWidthValue{}, WithASCII{}, InUpperCase{});
+}
+
+/**
+ * Per-thread scratch string, meant to be used together with hex_str_into() for formatting without allocations.
+ * The string keeps its capacity between the calls, so once it has grown to the size of the largest dump, no further
+ * heap allocations are made.
+ *
+ * @example auto &str = shp::scratch_buffer(); shp::hex_str_into(str, data); log(str);
+ *
+ * @return A reference to the calling thread's scratch string.
+ */
+inline std::string &scratch_buffer() {
+   static thread_local std::string buffer;
+   return buffer;
+}
+
+} // namespace shp
+
+#endif /* SIMPLE_HEX_PRINTER_INCLUDE_SHP_HEX_STR_H */
@@ -0,0 +1,129 @@
+/**
+ * @file   ostream.h
+ * @author Dennis Sitelew
+ * @date   Oct. 18, 2026
+ *
+ * Output stream adapters: printing the formatted values into std::ostream.
+ */
+#ifndef SIMPLE_HEX_PRINTER_INCLUDE_SHP_OSTREAM_H
+#define SIMPLE_HEX_PRINTER_INCLUDE_SHP_OSTREAM_H
+
+#include <shp/core.h>
+
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include <ios>
+#include <ostream>
+
+namespace shp {
+
+////////////////////////////////////////////////////////////////////////////////
+/// Class: format_backup
+////////////////////////////////////////////////////////////////////////////////
+
+//! Backs up the stream formatting and restores it upon destruction.
+class format_backup {
+public:
+   /**
+    * Constructor - stores stream formatting
+    * @param os Stream reference
+    */
+   explicit format_backup(std::ostream &os)
+      : os_(&os) {
+      old_ios_.copyfmt(os);
+   }
+
+   /**
+    * Destructor - restores formatting
+    */
+   ~format_backup() { os_->copyfmt(old_ios_); }
+
+public:
+   format_backup(const format_backup &) = delete;
+   format_backup(format_backup &&) = delete;
+
+   format_backup &operator=(const format_backup &) = delete;
+   format_backup &operator=(format_backup &&) = delete;
+
+private:
+   //! Output stream reference
+   std::ostream *os_;
+
+   //! State backup
+   std::ios old_ios_{nullptr};
+};
+
+namespace detail {
+
+//! Sink collecting the output in fixed-size chunks before passing them to an output stream.
+class stream_sink {
+public:
+   explicit stream_sink(std::ostream &os)
+      : os_{&os} {
+      // Nothing to do here
+   }
+
+public:
+   void put(char c) {
+      if (used_ == buffer_.size()) {
+         flush();
+      }
+      buffer_[used_++] = c;
+   }
+
+   void write(const char *data, std::size_t size) {
+      if (size > buffer_.size() - used_) {
+         flush();
+         if (size >= buffer_.size()) {
+            os_->write(data, static_cast<std::streamsize>(size));
+            return;
+         }
+      }
+      std::memcpy(buffer_.data() + used_, data, size);
+      used_ += size;
+   }
+
+   //! Get a buffer for writing up to `size` characters directly, the written characters are marked with commit()
+   char *acquire(std::size_t size) {
+      if (size > buffer_.size() - used_) {
+         flush();
+      }
+      return buffer_.data() + used_;
+   }
+
+   //! Mark all the characters up to `end` as written
+   void commit(char *end) { used_ = static_cast<std::size_t>(end - buffer_.data()); }
+
+   void flush() {
+      if (used_ != 0) {
+         os_->write(buffer_.data(), static_cast<std::streamsize>(used_));
+         used_ = 0;
+      }
+   }
+
+private:
+   std::ostream *os_;
+   std::array<char, max_acquire_size> buffer_;
+   std::size_t used_{0};
+};
+
+} // namespace detail
+
+template <typename T, typename WithPrefix, typename DoFill, typename InUpperCase>
+std::ostream &operator<<(std::ostream &os, const integral_hex_writer<T, WithPrefix, DoFill, InUpperCase> &v) {
+   using writer_t = integral_hex_writer<T, WithPrefix, DoFill, InUpperCase>;
+   const detail::stats_recorder recorder{sizeof(T)};
+
+   // The digits are written as is, without touching the stream formatting flags
+   char buffer[writer_t::max_size];
+   const auto last = detail::write_integral<T, WithPrefix::value, DoFill::value, InUpperCase::value>(buffer, v.value_);
+   os.write(buffer, last - buffer);
+
+   recorder.finish([&] { return static_cast<std::size_t>(last - buffer); });
+   return os;
+}
+
+} // namespace shp
+
+#endif /* SIMPLE_HEX_PRINTER_INCLUDE_SHP_OSTREAM_H */
@@ -0,0 +1,830 @@
+/**
+ * @file   pcap.h
+ * @author Dennis Sitelew
+ * @date   Oct. 18, 2026
+ *
+ * Dumping packets of pcap and pcapng capture files.
+ */
+#ifndef SIMPLE_HEX_PRINTER_INCLUDE_SHP_PCAP_H
+#define SIMPLE_HEX_PRINTER_INCLUDE_SHP_PCAP_H
+
+#include <shp/core.h>
+#include <shp/hex_dump.h>
+#include <shp/ostream.h>
+
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#if defined(_WIN32)
+#include <fstream>
+#include <iterator>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace shp {
+
+////////////////////////////////////////////////////////////////////////////////
+/// Class: pcap_file
+////////////////////////////////////////////////////////////////////////////////
+/**
+ * Read-only contents of a capture file. On POSIX systems regular files are memory-mapped, other files (and all files
+ * on Windows) are read into memory.
+ */
+class pcap_file {
+public:
+   /**
+    * Open a capture file.
+    * @param path File path
+    * @throws std::system_error if the file cannot be opened or read.
+    */
+   explicit pcap_file(const std::string &path) {
+#if defined(_WIN32)
+      read_all(path);
+#else
+      const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+      if (fd < 0) {
+         throw std::system_error{errno, std::generic_category(), "Error opening " + path};
+      }
+
+      try {
+         if (!map(fd)) {
+            read_all(fd, path);
+         }
+      } catch (...) {
+         ::close(fd);
+         throw;
+      }
+      ::close(fd);
+#endif
+   }
+
+   ~pcap_file() {
+#if !defined(_WIN32)
+      if (mapped_ != nullptr) {
+         ::munmap(mapped_, size_);
+      }
+#endif
+   }
+
+   pcap_file(const pcap_file &) = delete;
+   pcap_file &operator=(const pcap_file &) = delete;
+
+public:
+   const std::uint8_t *data() const { return data_; }
+   std::size_t size() const { return size_; }
+
+private:
+#if defined(_WIN32)
+   void read_all(const std::string &path) {
+      std::ifstream in{path, std::ios::binary};
+      if (!in) {
+         throw std::system_error{errno, std::generic_category(), "Error opening " + path};
+      }
+
+      buffer_.assign(std::istreambuf_iterator<char>{in}, std::istreambuf_iterator<char>{});
+      data_ = buffer_.data();
+      size_ = buffer_.size();
+   }
+#else
+   bool map(int fd) {
+      struct stat st {};
+      if (::fstat(fd, &st) != 0 || !S_ISREG(st.st_mode) || st.st_size == 0) {
+         return false;
+      }
+
+      size_ = static_cast<std::size_t>(st.st_size);
+      mapped_ = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+      if (mapped_ == MAP_FAILED) {
+         mapped_ = nullptr;
+         size_ = 0;
+         return false;
+      }
+
+      data_ = static_cast<const std::uint8_t *>(mapped_);
+      return true;
+   }
+
+   void read_all(int fd, const std::string &path) {
+      constexpr std::size_t chunk_size = 1U << 20U;
+
+      std::size_t used = 0;
+      for (;;) {
+         buffer_.resize(used + chunk_size);
+         const auto count = ::read(fd, &buffer_[used], chunk_size);
+         if (count < 0) {
+            if (errno == EINTR) {
+               continue;
+            }
+            throw std::system_error{errno, std::generic_category(), "Error reading " + path};
+         }
+
+         if (count == 0) {
+            break;
+         }
+         used += static_cast<std::size_t>(count);
+      }
+
+      buffer_.resize(used);
+      data_ = buffer_.data();
+      size_ = used;
+   }
+#endif
+
+private:
+   std::vector<std::uint8_t> buffer_;
+   void *mapped_{nullptr};
+
+   const std::uint8_t *data_{nullptr};
+   std::size_t size_{0};
+};
+
+////////////////////////////////////////////////////////////////////////////////
+/// Class: pcap_reader
+////////////////////////////////////////////////////////////////////////////////
+//! Packet record of a capture file, the data points into the capture
+struct pcap_packet {
+   //! Packet index in the capture, starting at 0
+   std::size_t index{0};
+
+   //! Whether the record has a timestamp (pcapng simple packet blocks don't)
+   bool has_timestamp{false};
+
+   //! Timestamp seconds since the epoch
+   std::uint64_t seconds{0};
+
+   //! Fractional part of the timestamp, with fraction_digits decimal digits
+   std::uint64_t fraction{0};
+   unsigned fraction_digits{0};
+
+   //! Original packet length
+   std::uint32_t length{0};
+
+   //! Captured packet data, may be shorter than the original packet
+   const std::uint8_t *data{nullptr};
+   std::uint32_t captured{0};
+};
+
+namespace detail {
+
+inline bool is_little_endian() {
+   const std::uint16_t value = 1;
+   std::uint8_t first;
+   std::memcpy(&first, &value, 1);
+   return first == 1;
+}
+
+inline std::uint32_t load_u32(const std::uint8_t *p, bool swap) {
+   std::uint32_t result;
+   std::memcpy(&result, p, sizeof(result));
+   if (swap) {
+      result = (result >> 24U) | ((result >> 8U) & 0xFF00U) | ((result << 8U) & 0xFF0000U) | (result << 24U);
+   }
+   return result;
+}
+
+inline std::uint16_t load_u16(const std::uint8_t *p, bool swap) {
+   std::uint16_t result;
+   std::memcpy(&result, p, sizeof(result));
+   if (swap) {
+      result = static_cast<std::uint16_t>((result >> 8U) | (result << 8U));
+   }
+   return result;
+}
+
+//! Timestamp resolution of a pcapng interface
+struct pcapng_interface {
+   //! Timestamp units per second, a power of 10 (decimal) or of 2
+   std::uint64_t units{1000000};
+   unsigned exponent{6};
+   bool decimal{true};
+
+   //! Offset, added to the timestamp seconds
+   std::int64_t offset{0};
+};
+
+} // namespace detail
+
+/**
+ * Sequential reader of the packet records in a pcap or pcapng capture, held in memory. The packet data is not copied.
+ *
+ * Classic pcap files are supported with microsecond and nanosecond timestamps in either byte order. For pcapng files
+ * the enhanced, simple and obsolete packet blocks are reported, the timestamp resolution and offset of every
+ * interface are taken into account, other blocks are skipped.
+ */
+class pcap_reader {
+public:
+   /**
+    * Constructor
+    * @param data Capture contents, should outlive the reader and the reported packets
+    * @param size Capture size
+    * @throws std::invalid_argument if the data doesn't start with a pcap or pcapng header.
+    */
+   pcap_reader(const std::uint8_t *data, std::size_t size)
+      : data_{data}
+      , size_{size} {
+      if (size < 4) {
+         fail("not a pcap or pcapng file");
+      }
+
+      const auto magic = detail::load_u32(data, false);
+      if (magic == 0x0A0D0D0AU) {
+         ng_ = true;
+         return;
+      }
+
+      for (const bool swap : {false, true}) {
+         const auto value = detail::load_u32(data, swap);
+         if (value == 0xA1B2C3D4U || value == 0xA1B23C4DU) {
+            swap_ = swap;
+            fraction_digits_ = value == 0xA1B2C3D4U ? 6 : 9;
+            if (size < 24) {
+               fail("truncated file header");
+            }
+            offset_ = 24;
+            return;
+         }
+      }
+      fail("not a pcap or pcapng file");
+   }
+
+public:
+   /**
+    * Read the next packet record.
+    * @param packet Packet to fill in
+    * @return false at the end of the capture.
+    * @throws std::invalid_argument on malformed or truncated records.
+    */
+   bool next(pcap_packet &packet) {
+      return ng_ ? next_ng(packet) : next_classic(packet);
+   }
+
+   //! Whether the capture is in the pcapng format
+   bool is_pcapng() const { return ng_; }
+
+private:
+   [[noreturn]] void fail(const std::string &what) const {
+      throw std::invalid_argument{"pcap: " + what + " at offset " + std::to_string(offset_)};
+   }
+
+   bool next_classic(pcap_packet &packet) {
+      if (offset_ == size_) {
+         return false;
+      }
+      if (size_ - offset_ < 16) {
+         fail("truncated packet record");
+      }
+
+      const auto header = data_ + offset_;
+      const auto captured = detail::load_u32(header + 8, swap_);
+      if (captured > size_ - offset_ - 16) {
+         fail("truncated packet data");
+      }
+
+      packet.index = index_++;
+      packet.has_timestamp = true;
+      packet.seconds = detail::load_u32(header, swap_);
+      packet.fraction = detail::load_u32(header + 4, swap_);
+      packet.fraction_digits = fraction_digits_;
+      packet.length = detail::load_u32(header + 12, swap_);
+      packet.data = header + 16;
+      packet.captured = captured;
+
+      offset_ += 16 + std::size_t{captured};
+      return true;
+   }
+
+   bool next_ng(pcap_packet &packet) {
+      while (offset_ != size_) {
+         if (size_ - offset_ < 12) {
+            fail("truncated block");
+         }
+
+         const auto block = data_ + offset_;
+         const auto type = detail::load_u32(block, false);
+         if (type == 0x0A0D0D0AU) {
+            // Section header block, the byte order and the interfaces are defined per section
+            const auto byte_order = detail::load_u32(block + 8, false);
+            if (byte_order != 0x1A2B3C4DU && byte_order != 0x4D3C2B1AU) {
+               fail("invalid section byte order");
+            }
+            swap_ = byte_order != 0x1A2B3C4DU;
+            interfaces_.clear();
+         }
+
+         const auto length = detail::load_u32(block + 4, swap_);
+         if (length < 12 || length % 4 != 0 || length > size_ - offset_) {
+            fail("invalid block length");
+         }
+
+         const auto body = block + 8;
+         const std::size_t body_size = length - 12;
+
+         // The offset still points to the block start while it's parsed, so that the errors report it
+         bool found = false;
+         switch (detail::load_u32(block, swap_)) {
+            case 1: // Interface description block
+               add_interface(body, body_size);
+               break;
+
+            case 2: // Obsolete packet block
+               if (body_size < 20) {
+                  fail("truncated packet block");
+               }
+               set_time(packet, detail::load_u16(body, swap_), body + 4);
+               found = set_data(packet, body + 20, body_size - 20, detail::load_u32(body + 12, swap_),
+                                detail::load_u32(body + 16, swap_));
+               break;
+
+            case 3: { // Simple packet block
+               if (body_size < 4) {
+                  fail("truncated packet block");
+               }
+               const auto original = detail::load_u32(body, swap_);
+               const auto available = static_cast<std::uint32_t>(body_size - 4);
+               packet.has_timestamp = false;
+               found = set_data(packet, body + 4, body_size - 4, original < available ? original : available,
+                                original);
+               break;
+            }
+
+            case 6: // Enhanced packet block
+               if (body_size < 20) {
+                  fail("truncated packet block");
+               }
+               set_time(packet, detail::load_u32(body, swap_), body + 4);
+               found = set_data(packet, body + 20, body_size - 20, detail::load_u32(body + 12, swap_),
+                                detail::load_u32(body + 16, swap_));
+               break;
+
+            default:
+               break;
+         }
+
+         offset_ += length;
+         if (found) {
+            return true;
+         }
+      }
+      return false;
+   }
+
+   void add_interface(const std::uint8_t *body, std::size_t size) {
+      detail::pcapng_interface result;
+
+      // Options follow the link type, reserved field and snapshot length
+      for (std::size_t pos = 8; pos + 4 <= size;) {
+         const auto code = detail::load_u16(body + pos, swap_);
+         const auto length = detail::load_u16(body + pos + 2, swap_);
+         const auto value = body + pos + 4;
+         if (code == 0 || pos + 4 + length > size) {
+            break;
+         }
+
+         if (code == 9 && length >= 1) {
+            // if_tsresol: a negative power of 10, or of 2 with the most significant bit set
+            result.decimal = (value[0] & 0x80U) == 0;
+            result.exponent = value[0] & 0x7FU;
+            if ((result.decimal && result.exponent > 19) || (!result.decimal && result.exponent > 63)) {
+               fail("unsupported timestamp resolution");
+            }
+
+            result.units = 1;
+            for (unsigned i = 0; i < result.exponent; ++i) {
+               result.units *= result.decimal ? 10U : 2U;
+            }
+         } else if (code == 14 && length >= 8) {
+            // if_tsoffset, a 64-bit value in the section byte order
+            const bool big_endian = detail::is_little_endian() == swap_;
+            const std::uint64_t first = detail::load_u32(value, swap_);
+            const std::uint64_t second = detail::load_u32(value + 4, swap_);
+            result.offset = static_cast<std::int64_t>(big_endian ? first << 32U | second : second << 32U | first);
+         }
+
+         pos += 4 + ((length + 3U) & ~3U);
+      }
+
+      interfaces_.push_back(result);
+   }
+
+   void set_time(pcap_packet &packet, std::uint32_t interface, const std::uint8_t *timestamp) {
+      if (interface >= interfaces_.size()) {
+         fail("packet for an unknown interface");
+      }
+      const auto &itf = interfaces_[interface];
+
+      const std::uint64_t high = detail::load_u32(timestamp, swap_);
+      const auto units = high << 32U | detail::load_u32(timestamp + 4, swap_);
+      packet.has_timestamp = true;
+      packet.seconds = units / itf.units + static_cast<std::uint64_t>(itf.offset);
+      packet.fraction = units % itf.units;
+      packet.fraction_digits = itf.exponent;
+
+      if (!itf.decimal) {
+         // Binary fractions are printed in nanoseconds
+         const auto shift = itf.exponent > 30 ? itf.exponent - 30 : 0U;
+         packet.fraction = ((packet.fraction >> shift) * 1000000000U) >> (itf.exponent - shift);
+         packet.fraction_digits = 9;
+      }
+   }
+
+   bool set_data(pcap_packet &packet,
+                 const std::uint8_t *data,
+                 std::size_t available,
+                 std::uint32_t captured,
+                 std::uint32_t original) {
+      if (captured > available) {
+         fail("truncated packet data");
+      }
+
+      packet.index = index_++;
+      packet.length = original;
+      packet.data = data;
+      packet.captured = captured;
+      return true;
+   }
+
+private:
+   const std::uint8_t *data_;
+   std::size_t size_;
+   std::size_t offset_{0};
+   std::size_t index_{0};
+
+   bool ng_{false};
+   bool swap_{false};
+   unsigned fraction_digits_{6};
+   std::vector<detail::pcapng_interface> interfaces_;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+/// Class: pcap_dump_writer
+////////////////////////////////////////////////////////////////////////////////
+namespace detail {
+
+inline std::size_t decimal_digits(std::uint64_t value) {
+   std::size_t result = 1;
+   for (; value >= 10; value /= 10) {
+      ++result;
+   }
+   return result;
+}
+
+//! Write a decimal value, padded with zeroes to at least `width` digits
+inline char *write_decimal(char *out, std::uint64_t value, std::size_t width = 0) {
+   const auto digits = decimal_digits(value);
+   const auto count = digits < width ? width : digits;
+   for (std::size_t i = count; i != 0; --i) {
+      out[i - 1] = static_cast<char>('0' + value % 10);
+      value /= 10;
+   }
+   return out + count;
+}
+
+} // namespace detail
+
+/**
+ * Helper class for dumping the packets of a capture file, every packet is preceded by a header line with its index,
+ * timestamp and length, and is printed with offsets, relative to the packet start. The packets are separated by an
+ * empty line.
+ *
+ * The output size of every packet is known upfront, so large captures are formatted by multiple threads in parallel,
+ * each writing its share of the packets directly into the output buffer.
+ */
+template <typename WithOffsets = PrintOffsets,
+          typename WithNibbleSeparation = SeparateNibbles,
+          typename RowWidthValue = RowWidth<16>,
+          typename WithASCII = PrintASCII,
+          typename InUpperCase = UpperCase>
+class pcap_dump_writer {
+private:
+   using self_t = pcap_dump_writer<WithOffsets, WithNibbleSeparation, RowWidthValue, WithASCII, InUpperCase>;
+   using packet_writer_t = iterator_hex_writer<const std::uint8_t *, WithOffsets, WithNibbleSeparation, RowWidthValue,
+                                               WithASCII, InUpperCase>;
+
+   //! Captures with a smaller output are formatted by a single thread
+   static const std::size_t min_parallel_size = 1U << 20U;
+
+   //! Output, formatted at once by print_to()
+   static const std::size_t window_size = 16U << 20U;
+
+public:
+   /**
+    * Constructor
+    * @param file Capture file
+    * @throws std::invalid_argument if the file is not a pcap or pcapng capture.
+    */
+   explicit pcap_dump_writer(std::shared_ptr<const pcap_file> file)
+      : file_{std::move(file)} {
+      // Report invalid files early, the packets are read when the dump is printed
+      static_cast<void>(pcap_reader{file_->data(), file_->size()});
+   }
+
+public:
+   /**
+    * Limit the dump to the packets with indices in the range [first, last).
+    * @param first Index of the first packet
+    * @param last Index past the last packet
+    * @return Reference to self
+    */
+   self_t &packets(std::size_t first, std::size_t last = std::numeric_limits<std::size_t>::max()) {
+      first_ = first;
+      last_ = last;
+      return *this;
+   }
+
+   /**
+    * Set the number of formatting threads.
+    * @param count Number of threads, 0 (default) - the number of hardware threads
+    * @return Reference to self
+    */
+   self_t &threads(std::size_t count) {
+      threads_ = count;
+      return *this;
+   }
+
+   /**
+    * Append the dump to a string, reusing the string capacity.
+    * The required space is calculated upfront, so the string is resized at most once.
+    * @param out Output string
+    * @throws std::invalid_argument on malformed capture records.
+    */
+   template <typename Traits, typename Allocator>
+   void append_to(std::basic_string<char, Traits, Allocator> &out) const {
+      const auto packets = collect();
+      const detail::stats_recorder recorder{captured_size(packets)};
+      const auto offsets = output_offsets(packets);
+
+      const auto offset = out.size();
+      const auto capacity = out.capacity();
+      out.resize(offset + offsets.back());
+      format(&out[offset], packets, offsets, 0, packets.size());
+
+      recorder.finish([&offsets] { return offsets.back(); }, out.capacity() != capacity ? 1 : 0);
+   }
+
+   /**
+    * Print the dump into a custom sink, @see iterator_hex_writer::print_to for the sink requirements.
+    * @param sink Output sink
+    * @throws std::invalid_argument on malformed capture records.
+    */
+   template <typename Sink>
+   void print_to(Sink &sink) const {
+      print_windows([&sink](const char *data, std::size_t size) { sink.write(data, size); });
+   }
+
+   /**
+    * Calculate the exact number of characters produced by this writer.
+    * @return Number of characters in the dump.
+    */
+   std::size_t formatted_size() const { return output_offsets(collect()).back(); }
+
+public:
+   template <typename OWithOffsets,
+             typename OWithNibbleSeparation,
+             typename ORowWidthValue,
+             typename OWithASCII,
+             typename OInUpperCase>
+   friend std::ostream &operator<<(
+      std::ostream &os,
+      const pcap_dump_writer<OWithOffsets, OWithNibbleSeparation, ORowWidthValue, OWithASCII, OInUpperCase> &v);
+
+private:
+   std::vector<pcap_packet> collect() const {
+      std::vector<pcap_packet> result;
+
+      pcap_reader reader{file_->data(), file_->size()};
+      pcap_packet packet;
+      while (reader.next(packet) && packet.index < last_) {
+         if (packet.index >= first_) {
+            result.push_back(packet);
+         }
+      }
+      return result;
+   }
+
+   //! Number of the captured bytes in the packets
+   static std::size_t captured_size(const std::vector<pcap_packet> &packets) {
+      std::size_t result = 0;
+      for (const auto &p : packets) {
+         result += p.captured;
+      }
+      return result;
+   }
+
+   static std::size_t header_size(const pcap_packet &p) {
+      // "Packet N: time S.F, length L[, captured C]\n"
+      std::size_t result = 7 + detail::decimal_digits(p.index) + 1;
+      if (p.has_timestamp) {
+         result += 6 + detail::decimal_digits(p.seconds) + (p.fraction_digits != 0 ? 1 + p.fraction_digits : 0) + 1;
+      }
+      result += 8 + detail::decimal_digits(p.length);
+      if (p.captured != p.length) {
+         result += 11 + detail::decimal_digits(p.captured);
+      }
+      return result + 1;
+   }
+
+   static std::size_t packet_size(const pcap_packet &p) {
+      const packet_writer_t writer{p.data, p.data + p.captured};
+      const auto dump = writer.formatted_size();
+      return header_size(p) + (dump != 0 ? dump + 1 : 0);
+   }
+
+   //! Output offsets of the packets, the last element is the total size
+   static std::vector<std::size_t> output_offsets(const std::vector<pcap_packet> &packets) {
+      std::vector<std::size_t> result(packets.size() + 1);
+      for (std::size_t i = 0; i < packets.size(); ++i) {
+         // Packets are separated by an empty line
+         result[i + 1] = result[i] + (i != 0 ? 1 : 0) + packet_size(packets[i]);
+      }
+      return result;
+   }
+
+   static char *write_header(char *out, const pcap_packet &p) {
+      static const char packet_text[] = "Packet ";
+      static const char time_text[] = " time ";
+      static const char length_text[] = " length ";
+      static const char captured_text[] = ", captured ";
+
+      std::memcpy(out, packet_text, sizeof(packet_text) - 1);
+      out = detail::write_decimal(out + sizeof(packet_text) - 1, p.index);
+      *out++ = ':';
+
+      if (p.has_timestamp) {
+         std::memcpy(out, time_text, sizeof(time_text) - 1);
+         out = detail::write_decimal(out + sizeof(time_text) - 1, p.seconds);
+         if (p.fraction_digits != 0) {
+            *out++ = '.';
+            out = detail::write_decimal(out, p.fraction, p.fraction_digits);
+         }
+         *out++ = ',';
+      }
+
+      std::memcpy(out, length_text, sizeof(length_text) - 1);
+      out = detail::write_decimal(out + sizeof(length_text) - 1, p.length);
+
+      if (p.captured != p.length) {
+         std::memcpy(out, captured_text, sizeof(captured_text) - 1);
+         out = detail::write_decimal(out + sizeof(captured_text) - 1, p.captured);
+      }
+
+      *out++ = '\n';
+      return out;
+   }
+
+   //! Format the packets [first, last) into a buffer, starting at the offset of the first packet
+   static void format_range(char *out,
+                            const std::vector<pcap_packet> &packets,
+                            const std::vector<std::size_t> &offsets,
+                            std::size_t first,
+                            std::size_t last) {
+      char *const base = out - offsets[first];
+      for (std::size_t i = first; i < last; ++i) {
+         const auto &p = packets[i];
+
+         char *pos = base + offsets[i];
+         if (i != 0) {
+            *pos++ = '\n';
+         }
+         pos = write_header(pos, p);
+
+         if (p.captured != 0) {
+            // The packets are a part of the recorded dump, so they are printed without the writer statistics
+            detail::pointer_sink sink{pos};
+            typename packet_writer_t::print_state ps{packet_writer_t{p.data, p.data + p.captured}};
+            packet_writer_t::print_all(sink, ps);
+            *(base + offsets[i + 1] - 1) = '\n';
+         }
+      }
+   }
+
+   //! Format the packets [first, last) into a buffer, splitting the work between the threads
+   void format(char *out,
+               const std::vector<pcap_packet> &packets,
+               const std::vector<std::size_t> &offsets,
+               std::size_t first,
+               std::size_t last) const {
+      const auto size = offsets[last] - offsets[first];
+
+      std::size_t count = threads_ != 0 ? threads_ : std::thread::hardware_concurrency();
+      if (size < min_parallel_size || count < 2 || last - first < 2) {
+         format_range(out, packets, offsets, first, last);
+         return;
+      }
+
+      // Split the packets into parts with roughly the same output size
+      std::vector<std::size_t> bounds{first};
+      for (std::size_t i = first; i < last && bounds.size() < count; ++i) {
+         if (offsets[i] - offsets[first] >= size * bounds.size() / count) {
+            if (i != bounds.back()) {
+               bounds.push_back(i);
+            }
+         }
+      }
+      bounds.push_back(last);
+
+      std::vector<std::thread> workers;
+      workers.reserve(bounds.size() - 2);
+      for (std::size_t part = 1; part + 1 < bounds.size(); ++part) {
+         workers.emplace_back([&, part] {
+            format_range(out + offsets[bounds[part]] - offsets[first], packets, offsets, bounds[part],
+                         bounds[part + 1]);
+         });
+      }
+      format_range(out, packets, offsets, bounds[0], bounds[1]);
+
+      for (auto &worker : workers) {
+         worker.join();
+      }
+   }
+
+   //! Format the dump in windows of limited size, passing every window to a callback
+   template <typename Callback>
+   void print_windows(Callback &&callback) const {
+      const auto packets = collect();
+      const detail::stats_recorder recorder{captured_size(packets)};
+      const auto offsets = output_offsets(packets);
+
+      std::string buffer;
+      for (std::size_t first = 0; first < packets.size();) {
+         // Every window contains at least one packet
+         std::size_t last = first + 1;
+         while (last < packets.size() && offsets[last + 1] - offsets[first] <= window_size) {
+            ++last;
+         }
+
+         buffer.resize(offsets[last] - offsets[first]);
+         format(&buffer[0], packets, offsets, first, last);
+         callback(buffer.data(), buffer.size());
+
+         first = last;
+      }
+
+      recorder.finish([&offsets] { return offsets.back(); });
+   }
+
+private:
+   std::shared_ptr<const pcap_file> file_;
+
+   //! Range of the dumped packet indices
+   std::size_t first_{0};
+   std::size_t last_{std::numeric_limits<std::size_t>::max()};
+
+   //! Number of formatting threads, 0 - the number of hardware threads
+   std::size_t threads_{0};
+};
+
+template <typename WithOffsets, typename WithNibbleSeparation, typename RowWidthValue, typename WithASCII,
+          typename InUpperCase>
+std::ostream &
+operator<<(std::ostream &os,
+           const pcap_dump_writer<WithOffsets, WithNibbleSeparation, RowWidthValue, WithASCII, InUpperCase> &v) {
+   v.print_windows([&os](const char *data, std::size_t size) { os.write(data, static_cast<std::streamsize>(size)); });
+   return os;
+}
+
+/**
+ * Construct a streamable object for dumping the packets of a pcap or pcapng capture file.
+ *
+ * @example std::cout << shp::hex_pcap("capture.pcapng").packets(100, 200);
+ *
+ * @tparam WithOffsets Controls whether the packet offsets should be printed out or not.
+ * @tparam WithNibbleSeparation Controls whether nibbles should be separated or not.
+ * @tparam RowWidthValue Number of bytes in a single row.
+ * @tparam WithASCII Controls whether ASCII values should be printed out or not.
+ * @tparam InUpperCase Controls whether HEX values should be printed out in upper-case or not.
+ * @param path Capture file path.
+ * @return A streamable object.
+ * @throws std::system_error if the file cannot be opened, std::invalid_argument if it is not a capture file.
+ */
+template <typename WithOffsets = PrintOffsets,
+          typename WithNibbleSeparation = SeparateNibbles,
+          typename RowWidthValue = RowWidth<16>,
+          typename WithASCII = PrintASCII,
+          typename InUpperCase = UpperCase>
+inline pcap_dump_writer<WithOffsets, WithNibbleSeparation, RowWidthValue, WithASCII, InUpperCase>
+hex_pcap(const std::string &path,
+         const WithOffsets = WithOffsets{},
+         const WithNibbleSeparation = WithNibbleSeparation{},
+         const RowWidthValue = RowWidthValue{},
+         const WithASCII = WithASCII{},
+         const InUpperCase = InUpperCase{}) {
+   return pcap_dump_writer<WithOffsets, WithNibbleSeparation, RowWidthValue, WithASCII, InUpperCase>{
+      std::make_shared<const pcap_file>(path)};
+}
+
+} // namespace shp
+
+#endif /* SIMPLE_HEX_PRINTER_INCLUDE_SHP_PCAP_H */
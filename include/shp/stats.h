@@ -0,0 +1,290 @@
+/**
+ * @file   stats.h
+ * @author Dennis Sitelew
+ * @date   Oct. 18, 2026
+ *
+ * Usage statistics of the library writers, see SHP_ENABLE_STATS.
+ */
+#ifndef SIMPLE_HEX_PRINTER_INCLUDE_SHP_STATS_H
+#define SIMPLE_HEX_PRINTER_INCLUDE_SHP_STATS_H
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#if defined(SHP_ENABLE_STATS)
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#endif
+
+namespace shp {
+
+////////////////////////////////////////////////////////////////////////////////
+/// Instrumentation
+////////////////////////////////////////////////////////////////////////////////
+// Writers record their usage statistics when SHP_ENABLE_STATS is defined. The statistics are aggregated per call
+// site, which is set with the SHP_STATS_SITE() or SHP_STATS_TAG(tag) macros for the rest of the enclosing scope.
+// Calls outside of such scopes are aggregated under "<unknown>". Without SHP_ENABLE_STATS all the instrumentation
+// compiles down to nothing.
+namespace stats {
+
+//! Usage statistics of a single call site
+struct call_site_stats {
+   std::string site;                 //!< Call site tag or the file:line location
+   std::uint64_t calls;              //!< Number of formatting calls
+   std::uint64_t input_bytes;        //!< Number of formatted bytes
+   std::uint64_t output_chars;       //!< Number of produced characters
+   std::uint64_t allocations;        //!< Number of output string allocations
+   std::chrono::nanoseconds elapsed; //!< Time spent formatting
+};
+
+#if defined(SHP_ENABLE_STATS)
+
+namespace detail {
+
+enum counter : std::size_t {
+   calls,
+   input_bytes,
+   output_chars,
+   allocations,
+   elapsed_ns,
+   counter_count,
+};
+
+//! Counters of a single call site in a single thread, only the owning thread updates the values
+struct site_slot {
+   explicit site_slot(std::string s)
+      : site{std::move(s)} {
+      // Nothing to do here
+   }
+
+   const std::string site;
+   std::array<std::atomic<std::uint64_t>, counter_count> values{};
+
+   //! Values at the time of the last reset, guarded by the registry mutex
+   std::array<std::uint64_t, counter_count> baseline{};
+
+   //! Next slot of the same thread
+   site_slot *next{nullptr};
+};
+
+//! Per-thread list of call site slots. Slots are only ever added, so it can be walked from any thread.
+struct thread_block {
+   thread_block() = default;
+   thread_block(const thread_block &) = delete;
+   thread_block &operator=(const thread_block &) = delete;
+
+   ~thread_block() {
+      for (auto slot = head.load(std::memory_order_acquire); slot != nullptr;) {
+         auto next = slot->next;
+         delete slot;
+         slot = next;
+      }
+   }
+
+   std::atomic<site_slot *> head{nullptr};
+};
+
+//! Counter values, indexed by the counter
+using counters = std::array<std::uint64_t, counter_count>;
+
+//! Blocks of the running threads, the counters of the exited threads are merged into the retired totals
+struct registry {
+   std::mutex mutex;
+   std::vector<const thread_block *> blocks;
+   std::map<std::string, counters> retired;
+};
+
+inline registry &get_registry() {
+   static registry instance;
+   return instance;
+}
+
+//! Thread-local recording state
+struct thread_state {
+   thread_state() {
+      auto &reg = get_registry();
+      std::lock_guard<std::mutex> lock{reg.mutex};
+      reg.blocks.push_back(&block);
+   }
+
+   ~thread_state() {
+      // Keep the statistics of the thread, but not its block, so that the registry doesn't grow with every thread
+      auto &reg = get_registry();
+      std::lock_guard<std::mutex> lock{reg.mutex};
+      for (auto slot = block.head.load(std::memory_order_acquire); slot != nullptr; slot = slot->next) {
+         auto &total = reg.retired[slot->site];
+         for (std::size_t i = 0; i < counter_count; ++i) {
+            total[i] += slot->values[i].load(std::memory_order_relaxed) - slot->baseline[i];
+         }
+      }
+      reg.blocks.erase(std::find(reg.blocks.begin(), reg.blocks.end(), &block));
+   }
+
+   thread_state(const thread_state &) = delete;
+   thread_state &operator=(const thread_state &) = delete;
+
+   //! Slot of a call site, the slots are kept until the thread exits
+   site_slot &slot(const std::string &site) {
+      auto it = lookup.find(site);
+      if (it != lookup.end()) {
+         return *it->second;
+      }
+
+      auto result = new site_slot{site};
+      result->next = block.head.load(std::memory_order_relaxed);
+      block.head.store(result, std::memory_order_release);
+      lookup.emplace(site, result);
+      return *result;
+   }
+
+   //! Slot of the current call site
+   site_slot &current() {
+      if (current_slot == nullptr) {
+         current_slot = &slot("<unknown>");
+      }
+      return *current_slot;
+   }
+
+   thread_block block;
+
+   //! Slots by the call site, which is copied, so the tags don't have to outlive the scopes
+   std::unordered_map<std::string, site_slot *> lookup;
+
+   //! Slot of the innermost scope, nullptr outside of any scope
+   site_slot *current_slot{nullptr};
+};
+
+inline thread_state &local_state() {
+   static thread_local thread_state state;
+   return state;
+}
+
+inline void add(std::atomic<std::uint64_t> &counter, std::uint64_t value) {
+   // Only the owning thread writes the counters, so there is no need for an atomic read-modify-write
+   counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+}
+
+} // namespace detail
+
+//! Sets the call site, used for aggregating the statistics, until the end of the scope. The tag is copied, equal tags
+//! are aggregated together.
+class scope {
+public:
+   explicit scope(const std::string &site)
+      : previous_{detail::local_state().current_slot} {
+      auto &state = detail::local_state();
+      state.current_slot = &state.slot(site);
+   }
+
+   ~scope() { detail::local_state().current_slot = previous_; }
+
+   scope(const scope &) = delete;
+   scope &operator=(const scope &) = delete;
+
+private:
+   detail::site_slot *previous_;
+};
+
+/**
+ * Collect the statistics from all threads, aggregated per call site.
+ * @return Call site statistics, the most expensive call sites first.
+ */
+inline std::vector<call_site_stats> snapshot() {
+   std::map<std::string, detail::counters> totals;
+
+   auto &reg = detail::get_registry();
+   {
+      std::lock_guard<std::mutex> lock{reg.mutex};
+      totals = reg.retired;
+      for (const auto block : reg.blocks) {
+         for (auto slot = block->head.load(std::memory_order_acquire); slot != nullptr; slot = slot->next) {
+            auto &total = totals[slot->site];
+            for (std::size_t i = 0; i < detail::counter_count; ++i) {
+               total[i] += slot->values[i].load(std::memory_order_relaxed) - slot->baseline[i];
+            }
+         }
+      }
+   }
+
+   std::vector<call_site_stats> result;
+   result.reserve(totals.size());
+   for (const auto &entry : totals) {
+      const auto &v = entry.second;
+      result.push_back({entry.first, v[detail::calls], v[detail::input_bytes], v[detail::output_chars],
+                        v[detail::allocations], std::chrono::nanoseconds{v[detail::elapsed_ns]}});
+   }
+
+   std::stable_sort(result.begin(), result.end(), [](const call_site_stats &lhs, const call_site_stats &rhs) {
+      return lhs.elapsed > rhs.elapsed;
+   });
+   return result;
+}
+
+//! Reset the statistics of all threads.
+inline void reset() {
+   auto &reg = detail::get_registry();
+   std::lock_guard<std::mutex> lock{reg.mutex};
+   reg.retired.clear();
+   for (const auto block : reg.blocks) {
+      for (auto slot = block->head.load(std::memory_order_acquire); slot != nullptr; slot = slot->next) {
+         for (std::size_t i = 0; i < detail::counter_count; ++i) {
+            slot->baseline[i] = slot->values[i].load(std::memory_order_relaxed);
+         }
+      }
+   }
+}
+
+#else
+
+class scope {
+public:
+   explicit scope(const char *) {
+      // Nothing to do here
+   }
+
+   explicit scope(const std::string &) {
+      // Nothing to do here
+   }
+
+   scope(const scope &) = delete;
+   scope &operator=(const scope &) = delete;
+};
+
+inline std::vector<call_site_stats> snapshot() {
+   return {};
+}
+
+inline void reset() {
+   // Nothing to do here
+}
+
+#endif
+
+} // namespace stats
+
+} // namespace shp
+
+#define SHP_STATS_CONCAT_IMPL(a, b) a##b
+#define SHP_STATS_CONCAT(a, b) SHP_STATS_CONCAT_IMPL(a, b)
+#define SHP_STATS_STRINGIFY_IMPL(x) #x
+#define SHP_STATS_STRINGIFY(x) SHP_STATS_STRINGIFY_IMPL(x)
+
+#if defined(SHP_ENABLE_STATS)
+//! Aggregate the statistics of the calls until the end of the scope under the given tag
+#define SHP_STATS_TAG(tag) const shp::stats::scope SHP_STATS_CONCAT(shp_stats_scope_, __LINE__){tag}
+
+//! Aggregate the statistics of the calls until the end of the scope under the current file:line
+#define SHP_STATS_SITE() SHP_STATS_TAG(__FILE__ ":" SHP_STATS_STRINGIFY(__LINE__))
+#else
+#define SHP_STATS_TAG(tag) static_cast<void>(0)
+#define SHP_STATS_SITE() static_cast<void>(0)
+#endif
+
+#endif /* SIMPLE_HEX_PRINTER_INCLUDE_SHP_STATS_H */
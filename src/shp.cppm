@@ -0,0 +1,80 @@
+/**
+ * @file   shp.cppm
+ * @author Dennis Sitelew
+ * @date   Oct. 18, 2026
+ *
+ * C++20 module interface: `import shp;` provides everything shp/shp.h does, except for the macros (use
+ * shp::stats::scope instead of SHP_STATS_TAG and SHP_STATS_SITE).
+ */
+module;
+
+#include <shp/shp.h>
+
+export module shp;
+
+export namespace shp {
+
+// Format specifiers
+using shp::Fill;
+using shp::FillType;
+using shp::HighlightMatches;
+using shp::HighlightMatchesType;
+using shp::LowerCase;
+using shp::NoASCII;
+using shp::NoFill;
+using shp::NoHighlight;
+using shp::NoNibbleSeparation;
+using shp::NoOffsets;
+using shp::NoPrefix;
+using shp::Prefix;
+using shp::PrefixType;
+using shp::PrintASCII;
+using shp::PrintASCIIType;
+using shp::PrintOffsets;
+using shp::PrintOffsetsType;
+using shp::RowWidth;
+using shp::SeparateNibbles;
+using shp::SeparateNibblesType;
+using shp::SingleRow;
+using shp::UpperCase;
+using shp::UpperCaseType;
+
+// Writers
+using shp::atomic_writer;
+using shp::c_array_writer;
+using shp::format_backup;
+using shp::hex_dump_cursor;
+using shp::hex_join_writer;
+using shp::hex_match_writer;
+using shp::hex_row_view;
+using shp::integral_hex_writer;
+using shp::is_container;
+using shp::iterator_hex_writer;
+using shp::pod_hex_writer;
+using shp::operator<<;
+
+// Helper functions
+using shp::append_hex;
+using shp::atomic_dump;
+using shp::atomic_rows;
+using shp::c_array;
+using shp::c_array_str;
+using shp::hex;
+using shp::hex_cursor;
+using shp::hex_find;
+using shp::hex_join;
+using shp::hex_join_str;
+using shp::hex_pattern;
+using shp::hex_rows;
+using shp::hex_str;
+using shp::hex_str_into;
+using shp::scratch_buffer;
+
+namespace stats {
+using shp::stats::call_site_stats;
+using shp::stats::reset;
+using shp::stats::scope;
+using shp::stats::snapshot;
+} // namespace stats
+
+} // namespace shp
@@ -0,0 +1,71 @@
+/**
+ * @file   allocation_count.cpp
+ * @author Dennis Sitelew
+ * @date   Oct. 18, 2026
+ *
+ * Replacements of the global allocation functions, counting the allocations. They are kept apart from the tests, so
+ * that the compiler can't inline them into the callers.
+ */
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace {
+
+std::atomic<std::size_t> allocations{0};
+
+} // namespace
+
+namespace shp_test {
+
+std::size_t allocation_count() {
+   return allocations.load();
+}
+
+} // namespace shp_test
+
+void *operator new(std::size_t size) {
+   ++allocations;
+   if (auto ptr = std::malloc(size == 0 ? 1 : size)) {
+      return ptr;
+   }
+   throw std::bad_alloc{};
+}
+
+void *operator new[](std::size_t size) {
+   return operator new(size);
+}
+
+void *operator new(std::size_t size, const std::nothrow_t &) noexcept {
+   ++allocations;
+   return std::malloc(size == 0 ? 1 : size);
+}
+
+void *operator new[](std::size_t size, const std::nothrow_t &tag) noexcept {
+   return operator new(size, tag);
+}
+
+void operator delete(void *ptr) noexcept {
+   std::free(ptr);
+}
+
+void operator delete[](void *ptr) noexcept {
+   std::free(ptr);
+}
+
+void operator delete(void *ptr, std::size_t) noexcept {
+   std::free(ptr);
+}
+
+void operator delete[](void *ptr, std::size_t) noexcept {
+   std::free(ptr);
+}
+
+void operator delete(void *ptr, const std::nothrow_t &) noexcept {
+   std::free(ptr);
+}
+
+void operator delete[](void *ptr, const std::nothrow_t &) noexcept {
+   std::free(ptr);
+}
@@ -0,0 +1,45 @@
+/**
+ * @file   allocations.cpp
+ * @author Dennis Sitelew
+ * @date   Oct. 18, 2026
+ */
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <shp/shp.h>
+
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+namespace shp_test {
+
+//! Number of global operator new calls so far, see allocation_count.cpp
+std::size_t allocation_count();
+
+} // namespace shp_test
+
+TEST_CASE("Steady state formatting doesn't allocate", "[hex_str_into]") {
+   std::vector<std::uint8_t> v(100);
+   std::iota(std::begin(v), std::end(v), 0);
+
+   auto &out = shp::scratch_buffer();
+   auto format = [&] {
+      shp::hex_str_into(out, v);
+      shp::append_hex(out, std::uint64_t{0xDEADBEEF});
+      shp::hex_str_into(out, v);
+   };
+
+   // The first round grows the scratch buffer
+   format();
+   const auto expected = out;
+
+   const auto before = shp_test::allocation_count();
+   for (int i = 0; i < 1000; ++i) {
+      format();
+   }
+   const auto after = shp_test::allocation_count();
+
+   REQUIRE(after == before);
+   REQUIRE(out == expected);
+}
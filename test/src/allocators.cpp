@@ -0,0 +1,122 @@
+/**
+ * @file   allocators.cpp
+ * @author Dennis Sitelew
+ * @date   Oct. 18, 2026
+ */
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <shp/shp.h>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+namespace {
+
+//! Minimal allocator, counting the allocated bytes
+template <typename T>
+struct counting_allocator {
+   using value_type = T;
+
+   explicit counting_allocator(size_t *counter)
+      : allocated{counter} {}
+
+   template <typename U>
+   counting_allocator(const counting_allocator<U> &o)
+      : allocated{o.allocated} {}
+
+   T *allocate(size_t n) {
+      *allocated += n * sizeof(T);
+      return std::allocator<T>{}.allocate(n);
+   }
+
+   void deallocate(T *p, size_t n) { std::allocator<T>{}.deallocate(p, n); }
+
+   template <typename U>
+   bool operator==(const counting_allocator<U> &o) const {
+      return allocated == o.allocated;
+   }
+
+   template <typename U>
+   bool operator!=(const counting_allocator<U> &o) const {
+      return allocated != o.allocated;
+   }
+
+   size_t *allocated;
+};
+
+} // namespace
+
+TEST_CASE("Custom allocators", "[allocators]") {
+   const vector<uint8_t> data(100, 0x42);
+
+   size_t allocated = 0;
+   const counting_allocator<int> alloc{&allocated};
+
+   const auto str = shp::hex_str(allocator_arg, alloc, data);
+   REQUIRE(string{str.data(), str.size()} == shp::hex_str(data));
+   REQUIRE(allocated >= str.size());
+
+   const auto value = shp::hex_str(allocator_arg, alloc, std::uint16_t{0xBEEF}, shp::NoPrefix{});
+   REQUIRE(string{value.data(), value.size()} == "BEEF");
+
+   struct pod {
+      uint16_t a;
+      uint16_t b;
+   };
+   const auto object = shp::hex_str(allocator_arg, alloc, pod{1, 2});
+   REQUIRE(string{object.data(), object.size()} == shp::hex_str(pod{1, 2}));
+
+   const auto list = shp::hex_str(allocator_arg, alloc, {1, 2});
+   REQUIRE(string{list.data(), list.size()} == shp::hex_str({1, 2}));
+
+   auto appended = str;
+   appended.clear();
+   shp::append_hex(appended, std::uint8_t{0xAB}, shp::NoPrefix{});
+   REQUIRE(string{appended.data(), appended.size()} == "AB");
+
+   string expected_found;
+   const auto finder = shp::hex_find(data, string{"\x42\x42", 2});
+   finder.append_to(expected_found);
+
+   basic_string<char, char_traits<char>, counting_allocator<char>> found{counting_allocator<char>{&allocated}};
+   finder.append_to(found);
+   REQUIRE(string{found.data(), found.size()} == expected_found);
+
+   const auto rows = shp::hex_rows(data);
+   basic_string<char, char_traits<char>, counting_allocator<char>> row{counting_allocator<char>{&allocated}};
+   rows.append_row(1, row);
+   rows.begin().append_to(row);
+   REQUIRE(string{row.data(), row.size()} == rows.row(1) + rows.row(0));
+}
+
+#if defined(__cpp_lib_memory_resource)
+TEST_CASE("Memory resources", "[allocators]") {
+   const vector<uint8_t> data(100, 0x42);
+
+   // All the allocations should be served from the arena
+   char buffer[16384];
+   std::pmr::monotonic_buffer_resource arena{buffer, sizeof(buffer), std::pmr::null_memory_resource()};
+
+   std::pmr::string str = shp::hex_str(allocator_arg, &arena, data);
+   REQUIRE(str.get_allocator().resource() == &arena);
+   REQUIRE(str == shp::hex_str(data).c_str());
+
+   shp::hex_str_into(str, std::uint16_t{0xBEEF});
+   REQUIRE(str == "0xBEEF");
+
+   std::pmr::memory_resource *resource = &arena;
+   const auto value = shp::hex_str(allocator_arg, resource, std::uint8_t{0x7F});
+   REQUIRE(value == "0x7F");
+
+   const auto rows = shp::hex_rows(data);
+   std::pmr::string row{&arena};
+   rows.begin().append_to(row);
+   rows.append_row(1, row);
+   REQUIRE(row == (rows.row(0) + rows.row(1)).c_str());
+}
+#endif
@@ -0,0 +1,220 @@
+/**
+ * @file   async_writer.cpp
+ * @author Dennis Sitelew
+ * @date   Oct. 18, 2026
+ */
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <shp/async_writer.h>
+#include <shp/shp.h>
+
+#include <cerrno>
+#include <cstdio>
+#include <deque>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <vector>
+
+using namespace std;
+
+namespace {
+
+string read_file(const string &path) {
+   ifstream in{path, ios::binary};
+   return string{istreambuf_iterator<char>{in}, istreambuf_iterator<char>{}};
+}
+
+vector<uint8_t> make_data(size_t size) {
+   vector<uint8_t> result(size);
+   for (size_t i = 0; i < size; ++i) {
+      result[i] = static_cast<uint8_t>(i * 7 + i / 251);
+   }
+   return result;
+}
+
+//! Fails a single write and passes all the others to the thread backend, recording the submitted file ranges
+class failing_backend : public shp::detail::write_backend {
+public:
+   struct range {
+      uint64_t offset;
+      size_t size;
+   };
+
+public:
+   failing_backend(int fd, size_t fail_at, vector<range> &submitted)
+      : inner_{fd}
+      , fail_at_{fail_at}
+      , submitted_(submitted) {
+      // Nothing to do here
+   }
+
+public:
+   void submit(size_t id, const char *data, size_t size, uint64_t offset) override {
+      for (const auto &p : pending_) {
+         REQUIRE(p.id != id);
+      }
+
+      const bool fail = submitted_.size() == fail_at_;
+      submitted_.push_back({offset, size});
+      pending_.push_back({id, fail});
+      if (!fail) {
+         inner_.submit(id, data, size, offset);
+      }
+   }
+
+   shp::detail::write_completion wait_one() override {
+      const auto p = pending_.front();
+      pending_.pop_front();
+      if (p.fail) {
+         return {p.id, EIO};
+      }
+
+      const auto result = inner_.wait_one();
+      REQUIRE(result.id == p.id);
+      return result;
+   }
+
+private:
+   struct pending {
+      size_t id;
+      bool fail;
+   };
+
+   shp::detail::thread_backend inner_;
+   size_t fail_at_;
+   vector<range> &submitted_;
+   deque<pending> pending_;
+};
+
+} // namespace
+
+TEST_CASE("Asynchronous file writer", "[async_writer]") {
+   const string path{"shp_async_writer_test.txt"};
+
+   // Small buffers to exercise the backpressure path
+   shp::async_file_writer::options opts;
+   opts.buffer_size = 4096;
+   opts.buffer_count = 3;
+
+   const auto data = make_data(100000);
+   const auto expected = shp::hex_str(data);
+
+   SECTION("Thread backend") {
+      opts.backend = shp::async_backend::thread;
+
+      shp::async_file_writer out{path, opts};
+      REQUIRE(out.backend() == shp::async_backend::thread);
+
+      shp::hex(data).print_to(out);
+      REQUIRE(out.bytes_written() == expected.size());
+      out.close();
+
+      REQUIRE(read_file(path) == expected);
+   }
+
+   SECTION("Automatic backend") {
+      {
+         shp::async_file_writer out{path, opts};
+         shp::hex(data).print_to(out);
+         out.put('\n');
+      }
+
+      REQUIRE(read_file(path) == expected + '\n');
+   }
+
+#if defined(SHP_HAS_IO_URING)
+   SECTION("io_uring backend") {
+      opts.backend = shp::async_backend::io_uring;
+
+      // The kernel may lack io_uring support or have it disabled, but once created, the writer should not fail
+      unique_ptr<shp::async_file_writer> out;
+      try {
+         out.reset(new shp::async_file_writer{path, opts});
+      } catch (const system_error &) {
+         SUCCEED("io_uring is not available");
+      }
+
+      if (out) {
+         REQUIRE(out->backend() == shp::async_backend::io_uring);
+
+         shp::hex(data).print_to(*out);
+         out->write("\n", 1);
+         out->close();
+
+         REQUIRE(read_file(path) == expected + '\n');
+      }
+   }
+#endif
+
+   SECTION("Flush") {
+      shp::async_file_writer out{path, opts};
+      out.write("abc", 3);
+      out.flush();
+      REQUIRE(read_file(path) == "abc");
+
+      out.put('d');
+      out.close();
+      REQUIRE(read_file(path) == "abcd");
+   }
+
+   std::remove(path.c_str());
+}
+
+TEST_CASE("Asynchronous file writer errors", "[async_writer]") {
+   REQUIRE_THROWS_AS(shp::async_file_writer{"/nonexistent/directory/file.txt"}, system_error);
+
+   if (numeric_limits<size_t>::max() > numeric_limits<uint32_t>::max()) {
+      shp::async_file_writer::options opts;
+      opts.buffer_size = static_cast<size_t>(numeric_limits<uint32_t>::max()) + 1;
+      REQUIRE_THROWS_AS(shp::async_file_writer("/nonexistent/directory/file.txt", opts), invalid_argument);
+   }
+
+   SECTION("Failed writes are not repeated") {
+      const string path{"shp_async_writer_error_test.txt"};
+
+      shp::async_file_writer::options opts;
+      opts.buffer_size = 4096;
+      opts.buffer_count = 2;
+
+      const auto data = make_data(100000);
+      const auto expected = shp::hex_str(data);
+
+      vector<failing_backend::range> submitted;
+      {
+         shp::async_file_writer out{path, opts, [&submitted](int fd, size_t) {
+                                       return unique_ptr<shp::detail::write_backend>{
+                                          new failing_backend{fd, 1, submitted}};
+                                    }};
+
+         REQUIRE_THROWS_AS(shp::hex(data).print_to(out), system_error);
+         out.write("tail", 4);
+         REQUIRE_NOTHROW(out.close());
+      }
+
+      // Every byte is submitted exactly once, only the failed buffer is missing from the file
+      REQUIRE(submitted.size() > 2);
+      uint64_t end = 0;
+      for (const auto &r : submitted) {
+         REQUIRE(r.offset == end);
+         end += r.size;
+      }
+
+      const auto failed = submitted[1];
+      const auto content = read_file(path);
+      REQUIRE(content.size() == end);
+      REQUIRE(content.substr(0, failed.offset) == expected.substr(0, failed.offset));
+      REQUIRE(content.substr(failed.offset, failed.size) == string(failed.size, '\0'));
+
+      const auto rest = failed.offset + failed.size;
+      REQUIRE(content.substr(rest, content.size() - rest - 4) == expected.substr(rest, content.size() - rest - 4));
+      REQUIRE(content.substr(content.size() - 4) == "tail");
+
+      std::remove(path.c_str());
+   }
+}
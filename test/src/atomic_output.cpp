@@ -0,0 +1,182 @@
+/**
+ * @file   atomic_output.cpp
+ * @author Dennis Sitelew
+ * @date   Oct. 18, 2026
+ */
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <shp/shp.h>
+
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <sstream>
+#include <streambuf>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+namespace {
+
+//! Thread-safe stream buffer, recording every write call separately
+class recording_buffer : public streambuf {
+public:
+   vector<string> chunks() {
+      lock_guard<mutex> lock{mutex_};
+      return chunks_;
+   }
+
+   string joined() {
+      lock_guard<mutex> lock{mutex_};
+      string result;
+      for (const auto &chunk : chunks_) {
+         result += chunk;
+      }
+      return result;
+   }
+
+protected:
+   streamsize xsputn(const char *s, streamsize n) override {
+      lock_guard<mutex> lock{mutex_};
+      chunks_.emplace_back(s, static_cast<size_t>(n));
+      return n;
+   }
+
+   int_type overflow(int_type ch) override {
+      if (!traits_type::eq_int_type(ch, traits_type::eof())) {
+         const auto c = traits_type::to_char_type(ch);
+         xsputn(&c, 1);
+      }
+      return ch;
+   }
+
+private:
+   mutex mutex_;
+   vector<string> chunks_;
+};
+
+vector<uint8_t> make_data(size_t size, uint8_t factor = 13) {
+   vector<uint8_t> result(size);
+   for (size_t i = 0; i < size; ++i) {
+      result[i] = static_cast<uint8_t>(i * factor);
+   }
+   return result;
+}
+
+//! Number of occurrences of every line
+map<string, size_t> count_lines(const string &text) {
+   map<string, size_t> result;
+   istringstream in{text};
+   for (string line; getline(in, line);) {
+      ++result[line];
+   }
+   return result;
+}
+
+} // namespace
+
+TEST_CASE("Atomic dumps", "[atomic_output]") {
+   const auto data = make_data(5000);
+   const auto expected = shp::hex_str(data);
+
+   recording_buffer buffer;
+   ostream os{&buffer};
+
+   SECTION("Whole dump") {
+      os << shp::atomic_dump(shp::hex(data));
+      REQUIRE(buffer.chunks() == vector<string>{expected + '\n'});
+
+      const auto value = buffer.chunks().size();
+      os << shp::atomic_dump(shp::hex(std::uint16_t{0xBEEF}));
+      REQUIRE(buffer.chunks().size() == value + 1);
+      REQUIRE(buffer.chunks().back() == "0xBEEF\n");
+   }
+
+   SECTION("Rows") {
+      os << shp::atomic_rows(shp::hex(data));
+
+      const auto chunks = buffer.chunks();
+      REQUIRE(chunks.size() == shp::hex_rows(data).size());
+
+      for (const auto &chunk : chunks) {
+         REQUIRE(chunk.back() == '\n');
+      }
+      REQUIRE(buffer.joined() == expected + '\n');
+      REQUIRE(chunks[1] == shp::hex_rows(data).row(1) + '\n');
+   }
+
+   SECTION("C-array rows") {
+      os << shp::atomic_rows(shp::c_array(data, "data"));
+
+      // Several complete rows may be written at once, but a row is never split
+      const auto chunks = buffer.chunks();
+      string joined;
+      for (const auto &chunk : chunks) {
+         REQUIRE(chunk.back() == '\n');
+         joined += chunk;
+      }
+      REQUIRE(joined == shp::c_array_str(data, "data"));
+   }
+
+   SECTION("Output with a line end") {
+      os << shp::atomic_dump(shp::c_array(data, "data"));
+      REQUIRE(buffer.chunks() == vector<string>{shp::c_array_str(data, "data")});
+   }
+
+   SECTION("Concurrent dumps") {
+      vector<thread> threads;
+      for (int t = 0; t < 4; ++t) {
+         threads.emplace_back([&os, &data] {
+            for (int i = 0; i < 20; ++i) {
+               os << shp::atomic_dump(shp::hex(data));
+            }
+         });
+      }
+      for (auto &t : threads) {
+         t.join();
+      }
+
+      const auto chunks = buffer.chunks();
+      REQUIRE(chunks.size() == 80);
+      for (const auto &chunk : chunks) {
+         REQUIRE(chunk == expected + '\n');
+      }
+   }
+
+   SECTION("Concurrent dumps and rows keep every line intact") {
+      // Last rows of both dumps are incomplete, so they would be joined with the next output without a line end
+      const auto other = make_data(1001, 7);
+
+      vector<thread> threads;
+      for (int t = 0; t < 4; ++t) {
+         threads.emplace_back([&os, &data, &other, t] {
+            for (int i = 0; i < 20; ++i) {
+               if (t % 2 == 0) {
+                  os << shp::atomic_rows(shp::hex(data));
+               } else {
+                  os << shp::atomic_dump(shp::hex(other));
+               }
+            }
+         });
+      }
+      for (auto &t : threads) {
+         t.join();
+      }
+
+      auto expected_lines = count_lines(expected);
+      for (const auto &line : count_lines(shp::hex_str(other))) {
+         expected_lines[line.first] += line.second;
+      }
+      for (auto &line : expected_lines) {
+         line.second *= 40;
+      }
+
+      const auto joined = buffer.joined();
+      REQUIRE(joined.back() == '\n');
+      REQUIRE(count_lines(joined) == expected_lines);
+   }
+}
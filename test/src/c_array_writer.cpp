@@ -0,0 +1,69 @@
+/**
+ * @file   c_array_writer.cpp
+ * @author Dennis Sitelew
+ * @date   Oct. 18, 2026
+ */
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <shp/shp.h>
+
+#include <deque>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+TEST_CASE("C-array initializers", "[c_array_writer]") {
+   const std::string data{"abcdefghijklm"};
+
+   SECTION("xxd compatible defaults") {
+      const std::string expected{"unsigned char foo_bin[] = {\n"
+                                 "  0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x6b, 0x6c,\n"
+                                 "  0x6d\n"
+                                 "};\n"
+                                 "unsigned int foo_bin_len = 13;\n"};
+
+      ostringstream os;
+      os << shp::c_array(data, "foo_bin");
+      REQUIRE(os.str() == expected);
+      REQUIRE(shp::c_array_str(data, "foo_bin") == expected);
+      REQUIRE(shp::c_array(data, "foo_bin").formatted_size() == expected.size());
+   }
+
+   SECTION("values only") {
+      REQUIRE(shp::c_array_str(data, {}, shp::NoPrefix{}, shp::RowWidth<4>{}, shp::UpperCase{})
+              == "  61, 62, 63, 64,\n"
+                 "  65, 66, 67, 68,\n"
+                 "  69, 6A, 6B, 6C,\n"
+                 "  6D\n");
+   }
+
+   SECTION("full rows") {
+      REQUIRE(shp::c_array_str(std::string{"abcd"}, {}, shp::Prefix{}, shp::RowWidth<2>{})
+              == "  0x61, 0x62,\n"
+                 "  0x63, 0x64\n");
+   }
+
+   SECTION("empty") {
+      REQUIRE(shp::c_array_str(std::string{}, "e_bin") == "unsigned char e_bin[] = {\n"
+                                                           "};\n"
+                                                           "unsigned int e_bin_len = 0;\n");
+   }
+
+   SECTION("large segmented input") {
+      std::vector<std::uint8_t> v(10000);
+      for (std::size_t i = 0; i < v.size(); ++i) {
+         v[i] = static_cast<std::uint8_t>(i * 7);
+      }
+      std::deque<std::uint8_t> d(std::begin(v), std::end(v));
+
+      const auto expected = shp::c_array_str(v, "blob");
+      REQUIRE(shp::c_array_str(d, "blob") == expected);
+
+      ostringstream os;
+      os << shp::c_array(d, "blob");
+      REQUIRE(os.str() == expected);
+   }
+}
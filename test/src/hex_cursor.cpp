@@ -0,0 +1,140 @@
+/**
+ * @file   hex_cursor.cpp
+ * @author Dennis Sitelew
+ * @date   Oct. 18, 2026
+ */
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <shp/shp.h>
+
+#include <cstdint>
+#include <deque>
+#include <list>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+namespace {
+
+vector<uint8_t> make_data(size_t size) {
+   vector<uint8_t> result(size);
+   for (size_t i = 0; i < size; ++i) {
+      result[i] = static_cast<uint8_t>(i * 7 + 3);
+   }
+   return result;
+}
+
+//! Print the whole dump, using steps of the given size
+template <typename Cursor>
+string print_in_steps(Cursor cursor, size_t step) {
+   string result;
+   while (cursor.step(result, step)) {
+      // Nothing to do here
+   }
+   return result;
+}
+
+} // namespace
+
+TEST_CASE("Dump cursor", "[hex_cursor]") {
+   const auto data = make_data(1000);
+   const auto expected = shp::hex_str(data);
+
+   SECTION("Steps of different sizes") {
+      for (size_t step : {1, 3, 15, 16, 17, 100, 999, 1000, 5000}) {
+         REQUIRE(print_in_steps(shp::hex_cursor(data), step) == expected);
+      }
+   }
+
+   SECTION("Progress") {
+      auto cursor = shp::hex_cursor(data);
+      REQUIRE(cursor.size() == 1000);
+      REQUIRE(cursor.formatted_size() == expected.size());
+
+      string out;
+      REQUIRE(cursor.step(out, 40));
+      REQUIRE(cursor.position() == 40);
+      REQUIRE_FALSE(cursor.done());
+
+      // The ASCII part of the incomplete row is printed with the rest of the row
+      REQUIRE(out == expected.substr(0, out.size()));
+      REQUIRE(out.back() != '\n');
+
+      REQUIRE(cursor.step(out, 0));
+      REQUIRE(cursor.position() == 40);
+
+      REQUIRE_FALSE(cursor.step(out, 10000));
+      REQUIRE(cursor.done());
+      REQUIRE(out == expected);
+
+      REQUIRE_FALSE(cursor.step(out, 10000));
+      REQUIRE(out == expected);
+   }
+
+   SECTION("Row steps") {
+      const auto rows = shp::hex_rows(data);
+      auto cursor = shp::hex_cursor(data);
+
+      string out;
+      shp::detail::string_sink sink{out};
+      REQUIRE(cursor.step(sink, 5));
+      REQUIRE(cursor.step_rows(sink, 1));
+      REQUIRE(out == rows.row(0));
+
+      REQUIRE(cursor.step_rows(sink, 2));
+      REQUIRE(out == rows.row(0) + '\n' + rows.row(1) + '\n' + rows.row(2));
+
+      while (cursor.step_rows(sink, 10)) {
+         // Nothing to do here
+      }
+      REQUIRE(out == expected);
+   }
+
+   SECTION("Custom layout") {
+      const auto custom = shp::hex_str(data, shp::NoOffsets{}, shp::NoNibbleSeparation{}, shp::RowWidth<10>{},
+                                       shp::NoASCII{}, shp::LowerCase{});
+      const auto cursor = shp::hex_cursor(data, shp::NoOffsets{}, shp::NoNibbleSeparation{}, shp::RowWidth<10>{},
+                                          shp::NoASCII{}, shp::LowerCase{});
+      REQUIRE(print_in_steps(cursor, 7) == custom);
+
+      const auto single = shp::hex_cursor(data, shp::NoOffsets{}, shp::SeparateNibbles{}, shp::SingleRow{},
+                                          shp::NoASCII{});
+      REQUIRE(print_in_steps(single, 33)
+              == shp::hex_str(data, shp::NoOffsets{}, shp::SeparateNibbles{}, shp::SingleRow{}, shp::NoASCII{}));
+   }
+
+   SECTION("Elements split between steps") {
+      struct triple {
+         uint8_t a, b, c;
+      };
+
+      vector<triple> triples(100);
+      for (size_t i = 0; i < triples.size(); ++i) {
+         triples[i] = {static_cast<uint8_t>(i), static_cast<uint8_t>(i + 100), static_cast<uint8_t>(i + 200)};
+      }
+
+      for (size_t step : {1, 2, 4, 16}) {
+         REQUIRE(print_in_steps(shp::hex_cursor(triples), step) == shp::hex_str(triples));
+      }
+   }
+
+   SECTION("Other ranges") {
+      const list<uint8_t> values(data.begin(), data.end());
+      REQUIRE(print_in_steps(shp::hex_cursor(values), 37) == expected);
+
+      const deque<uint8_t> segments(data.begin(), data.end());
+      REQUIRE(print_in_steps(shp::hex_cursor(segments), 37) == expected);
+   }
+
+   SECTION("Empty range") {
+      const vector<uint8_t> empty;
+      auto cursor = shp::hex_cursor(empty);
+
+      string out;
+      REQUIRE_FALSE(cursor.step(out, 100));
+      REQUIRE(cursor.done());
+      REQUIRE(out.empty());
+   }
+}
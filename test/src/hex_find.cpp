@@ -0,0 +1,125 @@
+/**
+ * @file   hex_find.cpp
+ * @author Dennis Sitelew
+ * @date   Oct. 18, 2026
+ */
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <shp/shp.h>
+
+#include <cstdint>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+TEST_CASE("HEX patterns", "[hex_find]") {
+   REQUIRE(shp::hex_pattern("DEADBEEF") == "\xDE\xAD\xBE\xEF");
+   REQUIRE(shp::hex_pattern(" 0xde ad\tbe ef ") == "\xDE\xAD\xBE\xEF");
+   REQUIRE(shp::hex_pattern("").empty());
+
+   REQUIRE_THROWS_AS(shp::hex_pattern("ABC"), invalid_argument);
+   REQUIRE_THROWS_AS(shp::hex_pattern("XY"), invalid_argument);
+}
+
+TEST_CASE("Pattern search", "[hex_find]") {
+   vector<uint8_t> data(256, 0);
+   for (size_t i = 0; i < data.size(); ++i) {
+      data[i] = static_cast<uint8_t>(i % 7);
+   }
+
+   const auto magic = shp::hex_pattern("DEADBEEF");
+   copy(magic.begin(), magic.end(), data.begin() + 14);
+   copy(magic.begin(), magic.end(), data.begin() + 200);
+
+   const auto rows = shp::hex_rows(data);
+
+   SECTION("Match offsets") {
+      REQUIRE(shp::hex_find(data, magic).matches() == vector<size_t>{14, 200});
+      REQUIRE(shp::hex_find(data, string{"\x03\x04\x05", 3}).matches().size() == 34);
+      REQUIRE(shp::hex_find(data, string{}).matches().empty());
+      REQUIRE(shp::hex_find(data, string(300, 'x')).matches().empty());
+
+      // Overlapping matches and patterns starting with common bytes
+      const vector<uint8_t> zeroes(8, 0);
+      REQUIRE(shp::hex_find(zeroes, string(3, '\0')).matches() == vector<size_t>{0, 1, 2, 3, 4, 5});
+
+      REQUIRE(shp::hex_find(data, magic).has_matches());
+      REQUIRE_FALSE(shp::hex_find(data, string{}).has_matches());
+      REQUIRE_FALSE(shp::hex_find(data, string{"\x06\x06", 2}).has_matches());
+   }
+
+   SECTION("Every byte matches") {
+      // A match per byte, the rows are printed once and the highlighting covers all of them
+      const vector<uint8_t> zeroes(100, 0);
+      const auto result = shp::hex_find(zeroes, string(1, '\0'), 0, shp::PrintOffsets{}, shp::SeparateNibbles{},
+                                        shp::RowWidth<16>{}, shp::PrintASCII{}, shp::UpperCase{},
+                                        shp::HighlightMatches{});
+      REQUIRE(result.matches().size() == 100);
+
+      string out;
+      result.append_to(out);
+      REQUIRE(out.find("--") == string::npos);
+      REQUIRE(out.find("0x60: \x1b[1;31m00 00 00 00\x1b[0m") != string::npos);
+
+      string plain;
+      shp::hex_find(zeroes, string(1, '\0')).append_to(plain);
+      REQUIRE(plain == shp::hex_str(zeroes));
+   }
+
+   SECTION("Rows with context") {
+      const auto result = shp::hex_find(data, magic, 1, shp::PrintOffsets{}, shp::SeparateNibbles{},
+                                        shp::RowWidth<16>{}, shp::PrintASCII{}, shp::UpperCase{}, shp::NoHighlight{});
+
+      // The first match spans two rows, there is no row before it
+      const auto expected = rows.row(0) + '\n' + rows.row(1) + '\n' + rows.row(2) + "\n--\n" + rows.row(11) + '\n'
+                          + rows.row(12) + '\n' + rows.row(13);
+
+      REQUIRE(shp::hex_str(data).find(rows.row(12)) != string::npos);
+
+      ostringstream os;
+      os << result;
+      REQUIRE(os.str() == expected);
+
+      string appended{"> "};
+      result.append_to(appended);
+      REQUIRE(appended == "> " + expected);
+   }
+
+   SECTION("Adjacent groups are merged") {
+      const auto result = shp::hex_find(data, magic, 5, shp::PrintOffsets{}, shp::SeparateNibbles{},
+                                        shp::RowWidth<16>{}, shp::PrintASCII{}, shp::UpperCase{}, shp::NoHighlight{});
+
+      string out;
+      result.append_to(out);
+      REQUIRE(out.find("--") == string::npos);
+      REQUIRE(out == shp::hex_str(data));
+   }
+
+   SECTION("No highlighting by default") {
+      string out;
+      shp::hex_find(data, magic).append_to(out);
+      REQUIRE(out.find('\x1b') == string::npos);
+      REQUIRE(out == rows.row(0) + '\n' + rows.row(1) + "\n--\n" + rows.row(12));
+   }
+
+   SECTION("Highlighting") {
+      const auto result = shp::hex_find(data, magic, 0, shp::PrintOffsets{}, shp::SeparateNibbles{},
+                                        shp::RowWidth<16>{}, shp::PrintASCII{}, shp::UpperCase{},
+                                        shp::HighlightMatches{});
+
+      string out;
+      result.append_to(out);
+
+      const string expected{"0xC0: 03 04 05 06 00 01 02 03 \x1b[1;31mDE AD BE EF\x1b[0m 01 02 03 04  "
+                            "........\x1b[1;31m....\x1b[0m...."};
+      REQUIRE(out.substr(out.find("0xC0")) == expected);
+      REQUIRE(out.find("0x00: 00 01 02 03 04 05 06 00 01 02 03 04 05 06 \x1b[1;31mDE AD\x1b[0m  "
+                       "..............\x1b[1;31m..\x1b[0m\n"
+                       "0x10: \x1b[1;31mBE EF\x1b[0m")
+              == 0);
+   }
+}
@@ -0,0 +1,77 @@
+/**
+ * @file   hex_join.cpp
+ * @author Dennis Sitelew
+ * @date   Oct. 18, 2026
+ */
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <shp/shp.h>
+
+#include <cstdint>
+#include <list>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+TEST_CASE("Joined values", "[hex_join]") {
+   const vector<uint32_t> values{0x1000, 0xDEADBEEF, 0, 0x2A};
+
+   SECTION("Defaults") {
+      REQUIRE(shp::hex_join_str(values) == "0x00001000, 0xDEADBEEF, 0x00000000, 0x0000002A");
+      REQUIRE(shp::hex_join(values).formatted_size() == shp::hex_join_str(values).size());
+   }
+
+   SECTION("Format options") {
+      const auto str = shp::hex_join_str(values, " ", shp::NoPrefix{}, shp::NoFill{}, shp::LowerCase{});
+      REQUIRE(str == "1000 deadbeef 0 2a");
+      REQUIRE(shp::hex_join(values, " ", shp::NoPrefix{}, shp::NoFill{}).formatted_size() == str.size());
+
+      REQUIRE(shp::hex_join_str(values, {}, shp::NoPrefix{}) == "00001000DEADBEEF000000000000002A");
+   }
+
+   SECTION("Signed and narrow values") {
+      const vector<int16_t> signed_values{-1, 2};
+      REQUIRE(shp::hex_join_str(signed_values) == "0xFFFF, 0x0002");
+
+      const list<uint8_t> bytes{1, 0xFF};
+      REQUIRE(shp::hex_join_str(bytes, ":", shp::NoPrefix{}) == "01:FF");
+   }
+
+   SECTION("Empty and single value ranges") {
+      const vector<uint64_t> empty;
+      REQUIRE(shp::hex_join_str(empty).empty());
+      REQUIRE(shp::hex_join(empty).formatted_size() == 0);
+
+      const vector<uint64_t> single{0xAB};
+      REQUIRE(shp::hex_join_str(single, ", ", shp::Prefix{}, shp::NoFill{}) == "0xAB");
+   }
+
+   SECTION("Streams and appending") {
+      vector<uint64_t> many(1000);
+      string expected;
+      for (size_t i = 0; i < many.size(); ++i) {
+         many[i] = 0x7F0000000000ULL + i * 0x1000U;
+         if (i != 0) {
+            expected += ", ";
+         }
+         expected += shp::hex_str(many[i]);
+      }
+
+      ostringstream os;
+      os << shp::hex_join(many);
+      REQUIRE(os.str() == expected);
+
+      string out{"> "};
+      shp::hex_join(many).append_to(out);
+      REQUIRE(out == "> " + expected);
+   }
+
+   SECTION("Long separators") {
+      const string separator(600, '-');
+      REQUIRE(shp::hex_join_str(values, separator, shp::NoPrefix{}, shp::NoFill{})
+              == "1000" + separator + "DEADBEEF" + separator + "0" + separator + "2A");
+   }
+}
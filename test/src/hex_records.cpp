@@ -0,0 +1,173 @@
+/**
+ * @file   hex_records.cpp
+ * @author Dennis Sitelew
+ * @date   Oct. 18, 2026
+ */
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <shp/hex_records.h>
+
+#include <cstdint>
+#include <deque>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+namespace {
+
+vector<uint8_t> make_data(size_t size) {
+   vector<uint8_t> result(size);
+   uint32_t state = 12345;
+   for (auto &v : result) {
+      state = state * 1103515245U + 12345U;
+      v = static_cast<uint8_t>(state >> 16U);
+   }
+   return result;
+}
+
+template <typename Writer>
+string render(const Writer &writer) {
+   string result;
+   writer.append_to(result);
+   REQUIRE(result.size() == writer.formatted_size());
+
+   ostringstream os;
+   os << writer;
+   REQUIRE(os.str() == result);
+   return result;
+}
+
+} // namespace
+
+TEST_CASE("Intel HEX output", "[hex_records]") {
+   SECTION("Data records") {
+      const vector<uint8_t> data{0x21, 0x46, 0x01, 0x36, 0x01, 0x21, 0x47, 0x01,
+                                 0x36, 0x00, 0x7E, 0xFE, 0x09, 0xD2, 0x19, 0x01};
+      REQUIRE(render(shp::intel_hex(data, 0x100)) == ":10010000214601360121470136007EFE09D2190140\n"
+                                                      ":00000001FF\n");
+   }
+
+   SECTION("Extended addresses and start records") {
+      const vector<uint8_t> data(20, 0xAA);
+      REQUIRE(render(shp::intel_hex(data, 0x1FFF8, 8).start_address(0x08000131))
+              == ":020000040001F9\n"
+                 ":08FFF800AAAAAAAAAAAAAAAAB1\n"
+                 ":020000040002F8\n"
+                 ":08000000AAAAAAAAAAAAAAAAA8\n"
+                 ":04000800AAAAAAAA4C\n"
+                 ":0400000508000131BD\n"
+                 ":00000001FF\n");
+   }
+
+   SECTION("Empty input") {
+      REQUIRE(render(shp::intel_hex(vector<uint8_t>{})) == ":00000001FF\n");
+   }
+
+   SECTION("Invalid arguments") {
+      const vector<uint8_t> data(16);
+      REQUIRE_THROWS_AS(shp::intel_hex(data, 0, 0), invalid_argument);
+      REQUIRE_THROWS_AS(shp::intel_hex(data, 0, 256), invalid_argument);
+      REQUIRE_THROWS_AS(shp::intel_hex(data, 0xFFFFFFF8U), invalid_argument);
+   }
+}
+
+TEST_CASE("S-record output", "[hex_records]") {
+   SECTION("16-bit addresses") {
+      const vector<uint8_t> data{0x7C, 0x08, 0x02, 0xA6};
+      REQUIRE(render(shp::srec(data)) == "S0030000FC\n"
+                                         "S10700007C0802A6CC\n"
+                                         "S5030001FB\n"
+                                         "S9030000FC\n");
+   }
+
+   SECTION("Address width follows the highest address") {
+      const vector<uint8_t> data(3, 0x11);
+      REQUIRE(render(shp::srec(data, 0x10000).header("hi"))
+              == "S0050000686929\n"
+                 "S207010000111111C4\n"
+                 "S5030001FB\n"
+                 "S804000000FB\n");
+
+      const auto wide = render(shp::srec(data, 0, 16).start_address(0x08000000));
+      REQUIRE(wide.find("S30800000000111111C4\n") != string::npos);
+      REQUIRE(wide.find("S70508000000F2\n") != string::npos);
+   }
+
+   SECTION("Invalid arguments") {
+      const vector<uint8_t> data(16);
+      REQUIRE_THROWS_AS(shp::srec(data, 0, 253), invalid_argument);
+      REQUIRE_THROWS_AS(shp::srec(data, 0x1000000, 251), invalid_argument);
+      REQUIRE_THROWS_AS(shp::srec(data).header(string(253, 'x')), invalid_argument);
+   }
+}
+
+TEST_CASE("Record round trips", "[hex_records]") {
+   const auto data = make_data(200000);
+   const deque<uint8_t> segmented(data.begin(), data.end());
+
+   SECTION("Intel HEX") {
+      for (size_t record_size : {1, 16, 32, 255}) {
+         const auto text = render(shp::intel_hex(data, 0x0800FF00, record_size).start_address(0x0800FF01));
+         REQUIRE(render(shp::intel_hex(segmented, 0x0800FF00, record_size).start_address(0x0800FF01)) == text);
+
+         const auto image = shp::parse_intel_hex(text);
+         REQUIRE(image.segments.size() == 1);
+         REQUIRE(image.segments[0].address == 0x0800FF00);
+         REQUIRE(image.segments[0].data == data);
+         REQUIRE(image.has_start_address);
+         REQUIRE(image.start_address == 0x0800FF01);
+      }
+   }
+
+   SECTION("S-records") {
+      for (size_t record_size : {1, 16, 250}) {
+         const auto text = render(shp::srec(data, 0xFF000000U, record_size).header("image"));
+         REQUIRE(render(shp::srec(segmented, 0xFF000000U, record_size).header("image")) == text);
+
+         const auto image = shp::parse_srec(text);
+         REQUIRE(image.header == "image");
+         REQUIRE(image.segments.size() == 1);
+         REQUIRE(image.segments[0].address == 0xFF000000U);
+         REQUIRE(image.segments[0].data == data);
+      }
+   }
+}
+
+TEST_CASE("Record parsers", "[hex_records]") {
+   SECTION("Intel HEX") {
+      const auto image = shp::parse_intel_hex(":020000001122CB\r\n"
+                                              "\r\n"
+                                              ":02000200334485\n"
+                                              ":020000021000EC\n"
+                                              ":02000000556643\n"
+                                              ":0400000300001000E9\n"
+                                              ":00000001FF\n"
+                                              "ignored after the end of file\n");
+      REQUIRE(image.segments.size() == 2);
+      REQUIRE(image.segments[0].address == 0);
+      REQUIRE(image.segments[0].data == vector<uint8_t>{0x11, 0x22, 0x33, 0x44});
+      REQUIRE(image.segments[1].address == 0x10000);
+      REQUIRE(image.segments[1].data == vector<uint8_t>{0x55, 0x66});
+      REQUIRE(image.start_address == 0x1000);
+   }
+
+   SECTION("Errors") {
+      REQUIRE_THROWS_AS(shp::parse_intel_hex(":0200000011223B\n"), invalid_argument);
+      REQUIRE_THROWS_AS(shp::parse_intel_hex("0200000011223A\n"), invalid_argument);
+      REQUIRE_THROWS_AS(shp::parse_intel_hex(":0300000011223A\n"), invalid_argument);
+      REQUIRE_THROWS_AS(shp::parse_intel_hex(":02000000112G3A\n"), invalid_argument);
+      REQUIRE_THROWS_AS(shp::parse_srec("S10700007C0802A6A5\n"), invalid_argument);
+      REQUIRE_THROWS_AS(shp::parse_srec("S40700007C0802A6A4\n"), invalid_argument);
+
+      try {
+         shp::parse_srec("S0030000FC\nS10700007C0802A6A5\n");
+         FAIL("Exception expected");
+      } catch (const invalid_argument &e) {
+         REQUIRE(string{e.what()} == "S-record line 2: checksum mismatch");
+      }
+   }
+}
@@ -0,0 +1,96 @@
+/**
+ * @file   hex_rows.cpp
+ * @author Dennis Sitelew
+ * @date   Oct. 18, 2026
+ */
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <shp/shp.h>
+
+#include <cstdint>
+#include <list>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+namespace {
+
+template <typename View>
+string join_rows(const View &view) {
+   string result;
+   for (auto it = view.begin(); it != view.end(); ++it) {
+      if (it.index() != 0) {
+         result += '\n';
+      }
+      result += *it;
+   }
+   return result;
+}
+
+} // namespace
+
+TEST_CASE("Row view", "[hex_rows]") {
+   vector<uint8_t> data(1000);
+   for (size_t i = 0; i < data.size(); ++i) {
+      data[i] = static_cast<uint8_t>(i * 31);
+   }
+
+   SECTION("Rows match the full dump") {
+      const auto rows = shp::hex_rows(data);
+      REQUIRE(rows.size() == 63);
+      REQUIRE(join_rows(rows) == shp::hex_str(data));
+
+      // Random access, the offset width is shared by all rows
+      REQUIRE(rows.row(62) == "0x3E0: 20 3F 5E 7D 9C BB DA F9                           ?^}....");
+      REQUIRE(rows.row(62).size() == rows.row_size(62));
+      REQUIRE(rows.row(1) == *next(rows.begin()));
+
+      string out{"> "};
+      rows.append_row(0, out);
+      REQUIRE(out == "> " + rows.row(0));
+   }
+
+   SECTION("Custom layout") {
+      const auto rows = shp::hex_rows(data, shp::NoOffsets{}, shp::NoNibbleSeparation{}, shp::RowWidth<12>{},
+                                      shp::NoASCII{}, shp::LowerCase{});
+      REQUIRE(join_rows(rows)
+              == shp::hex_str(data, shp::NoOffsets{}, shp::NoNibbleSeparation{}, shp::RowWidth<12>{}, shp::NoASCII{},
+                              shp::LowerCase{}));
+   }
+
+   SECTION("Rows splitting elements") {
+      struct triple {
+         uint8_t a, b, c;
+      };
+
+      vector<triple> triples(50);
+      for (size_t i = 0; i < triples.size(); ++i) {
+         triples[i] = {static_cast<uint8_t>(i), static_cast<uint8_t>(i + 100), static_cast<uint8_t>(i + 200)};
+      }
+
+      const auto rows = shp::hex_rows(triples, shp::PrintOffsets{}, shp::SeparateNibbles{}, shp::RowWidth<4>{});
+      REQUIRE(rows.size() == 38);
+      REQUIRE(join_rows(rows) == shp::hex_str(triples, shp::PrintOffsets{}, shp::SeparateNibbles{}, shp::RowWidth<4>{}));
+
+      for (size_t i = 0; i < rows.size(); ++i) {
+         REQUIRE(rows.row(i) == *next(rows.begin(), static_cast<ptrdiff_t>(i)));
+      }
+   }
+
+   SECTION("Forward ranges") {
+      const list<uint8_t> values(data.begin(), data.end());
+      const auto rows = shp::hex_rows(values);
+      REQUIRE(rows.size() == 63);
+      REQUIRE(join_rows(rows) == shp::hex_str(data));
+   }
+
+   SECTION("Empty range") {
+      const vector<uint8_t> empty;
+      const auto rows = shp::hex_rows(empty);
+      REQUIRE(rows.empty());
+      REQUIRE(rows.size() == 0);
+      REQUIRE(rows.begin() == rows.end());
+   }
+}
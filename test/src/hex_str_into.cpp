@@ -0,0 +1,64 @@
+/**
+ * @file   hex_str_into.cpp
+ * @author Dennis Sitelew
+ * @date   Oct. 18, 2026
+ */
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <shp/shp.h>
+
+#include <array>
+#include <cstdint>
+#include <numeric>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+TEST_CASE("Appending to strings", "[hex_str_into]") {
+   SECTION("integral") {
+      std::string out{"value: "};
+      shp::append_hex(out, std::uint16_t{0xBEEF});
+      shp::append_hex(out, std::uint16_t{0xA}, shp::NoPrefix{}, shp::NoFill{}, shp::LowerCase{});
+      REQUIRE(out == "value: 0xBEEFa");
+   }
+
+   SECTION("container") {
+      std::vector<std::uint8_t> v{0xDE, 0xAD};
+      std::string out{"> "};
+      shp::append_hex(out, v, shp::NoOffsets{}, shp::NoNibbleSeparation{}, shp::SingleRow{}, shp::NoASCII{});
+      REQUIRE(out == "> DEAD");
+   }
+
+   SECTION("initializer_list") {
+      std::initializer_list<std::uint8_t> value = {0xBE, 0xEF};
+      std::string out{"> "};
+      shp::append_hex(out, value, shp::NoOffsets{}, shp::NoNibbleSeparation{}, shp::SingleRow{}, shp::NoASCII{});
+      REQUIRE(out == "> BEEF");
+   }
+
+   SECTION("POD") {
+      struct foo {
+         std::uint8_t a;
+         std::uint8_t b;
+      } value{0xBE, 0xEF};
+
+      std::string out{"> "};
+      shp::append_hex(out, value, shp::NoOffsets{}, shp::SeparateNibbles{}, shp::SingleRow{}, shp::NoASCII{});
+      REQUIRE(out == "> BE EF");
+   }
+}
+
+TEST_CASE("Replacing string contents", "[hex_str_into]") {
+   std::array<std::uint8_t, 20> v{};
+   std::iota(std::begin(v), std::end(v), 0x30);
+
+   std::string out{"garbage"};
+   shp::hex_str_into(out, v);
+   REQUIRE(out == shp::hex_str(v));
+   REQUIRE(out.size() == shp::hex(v).formatted_size());
+
+   shp::hex_str_into(out, std::uint32_t{0x10});
+   REQUIRE(out == "0x00000010");
+}
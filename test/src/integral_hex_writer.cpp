@@ -182,3 +182,53 @@ TEST_CASE("String conversion", "[integral_hex_writer]") {
       REQUIRE(shp::hex_str(r) == "0x000000FA");
    }
 }
+
+TEST_CASE("Digits without fill", "[integral_hex_writer]") {
+   SECTION("zero") {
+      REQUIRE(shp::hex_str(std::uint64_t{0}, shp::Prefix{}, shp::NoFill{}) == "0x0");
+      REQUIRE(shp::hex_str(false, shp::NoPrefix{}, shp::NoFill{}) == "0");
+   }
+
+   SECTION("every digit count") {
+      std::uint64_t v = 0;
+      string expected;
+      for (int i = 1; i <= 16; ++i) {
+         v = (v << 4U) | static_cast<std::uint64_t>((i - 1) % 15 + 1);
+         expected += "123456789ABCDEF"[(i - 1) % 15];
+         REQUIRE(shp::hex_str(v, shp::NoPrefix{}, shp::NoFill{}) == expected);
+         REQUIRE(shp::hex(v, shp::NoPrefix{}, shp::NoFill{}).formatted_size() == expected.size());
+      }
+   }
+
+   SECTION("all the nibble values") {
+      REQUIRE(shp::hex_str(std::uint64_t{0x0123456789ABCDEF}, shp::Prefix{}, shp::Fill{}, shp::LowerCase{})
+              == "0x0123456789abcdef");
+      REQUIRE(shp::hex_str(std::int64_t{-1}, shp::NoPrefix{}, shp::NoFill{}) == "FFFFFFFFFFFFFFFF");
+      REQUIRE(shp::hex_str(std::int16_t{-2}, shp::NoPrefix{}, shp::NoFill{}) == "FFFE");
+   }
+
+   SECTION("sinks") {
+      string out{"> "};
+      shp::detail::string_sink sink{out};
+      shp::hex(std::uint16_t{0x0ABC}, shp::Prefix{}, shp::NoFill{}, shp::LowerCase{}).print_to(sink);
+      REQUIRE(out == "> 0xabc");
+   }
+}
+
+#if defined(SHP_HAS_INT128)
+TEST_CASE("128-bit values", "[integral_hex_writer]") {
+   __extension__ typedef unsigned __int128 u128;
+   __extension__ typedef __int128 i128;
+
+   const u128 v = (static_cast<u128>(0x0123456789ABCDEFULL) << 64U) | 0xFEDCBA9876543210ULL;
+   REQUIRE(shp::hex_str(v) == "0x0123456789ABCDEFFEDCBA9876543210");
+   REQUIRE(shp::hex_str(v, shp::NoPrefix{}, shp::NoFill{}) == "123456789ABCDEFFEDCBA9876543210");
+   REQUIRE(shp::hex_str(u128{0x42}, shp::NoPrefix{}, shp::NoFill{}) == "42");
+   REQUIRE(shp::hex_str(static_cast<u128>(1) << 64U, shp::NoPrefix{}, shp::NoFill{}) == "10000000000000000");
+   REQUIRE(shp::hex_str(i128{-1}, shp::NoPrefix{}) == string(32, 'F'));
+
+   ostringstream os;
+   os << shp::hex(i128{0x10}, shp::Prefix{}, shp::NoFill{}, shp::LowerCase{});
+   REQUIRE(os.str() == "0x10");
+}
+#endif
@@ -8,8 +8,16 @@
 
 #include <shp/shp.h>
 
+#include <deque>
+#include <list>
 #include <numeric>
+#include <sstream>
 #include <string>
+#include <vector>
+
+#if __cplusplus >= 201703L
+#include <string_view>
+#endif
 
 using namespace std;
 
@@ -165,3 +173,105 @@ TEST_CASE("Check bool vectors", "[iterator_hex_writer]") {
    os << shp::hex(v, shp::NoOffsets{}, shp::NoNibbleSeparation{}, shp::SingleRow{}, shp::NoASCII{});
    REQUIRE(os.str() == "01000101");
 }
+
+// Behavior fixes of the original writer: NoASCII was ignored for dumps of more than one row, and the offset width was
+// calculated from the number of elements instead of the number of bytes
+TEST_CASE("Original writer fixes", "[iterator_hex_writer][fixes]") {
+   SECTION("Multirow without ASCII") {
+      std::array<std::uint8_t, 6> v{};
+      std::iota(std::begin(v), std::end(v), 0x30);
+
+      auto result = shp::hex_str(v, shp::PrintOffsets{}, shp::SeparateNibbles{}, shp::RowWidth<4>{}, shp::NoASCII{});
+      REQUIRE(result == "0x00: 30 31 32 33\n"
+                        "0x04: 34 35");
+   }
+
+   SECTION("Address width covers all bytes") {
+      // 17 elements of 16 bytes each - 272 bytes in total, the last row starts at 0x100
+      std::array<std::array<std::uint8_t, 16>, 17> v{};
+      auto result =
+         shp::hex_str(v, shp::PrintOffsets{}, shp::NoNibbleSeparation{}, shp::RowWidth<16>{}, shp::NoASCII{});
+      REQUIRE(result.substr(0, 6) == "0x000:");
+      REQUIRE(result.substr(result.size() - 39, 6) == "0x100:");
+   }
+}
+
+TEST_CASE("Base offset", "[iterator_hex_writer]") {
+   std::array<std::uint8_t, 6> v{};
+   std::iota(std::begin(v), std::end(v), 0x30);
+
+   using writer_t = shp::iterator_hex_writer<const std::uint8_t *, shp::PrintOffsets, shp::SeparateNibbles,
+                                             shp::RowWidth<4>, shp::NoASCII>;
+
+   SECTION("Offsets start at the base") {
+      auto writer = writer_t{v.data(), v.data() + v.size()};
+      writer.base_offset(0xFE);
+
+      const std::string expected = "0x0FE: 30 31 32 33\n"
+                                   "0x102: 34 35";
+      REQUIRE(writer.formatted_size() == expected.size());
+
+      std::string result;
+      writer.append_to(result);
+      REQUIRE(result == expected);
+
+      ostringstream os;
+      os << writer;
+      REQUIRE(os.str() == expected);
+   }
+
+   SECTION("Minimal offset width") {
+      auto writer = writer_t{v.data(), v.data() + v.size()};
+      writer.base_offset(0x10).offset_width(8);
+
+      std::string result;
+      writer.append_to(result);
+      REQUIRE(result == "0x00000010: 30 31 32 33\n"
+                        "0x00000014: 34 35");
+      REQUIRE(writer.formatted_size() == result.size());
+   }
+}
+
+TEST_CASE("Non-contiguous containers", "[iterator_hex_writer]") {
+   // Big enough to span multiple std::deque blocks
+   std::vector<std::uint8_t> v(5000);
+   std::iota(std::begin(v), std::end(v), 0);
+   const auto expected = shp::hex_str(v);
+
+   SECTION("deque") {
+      std::deque<std::uint8_t> d(std::begin(v), std::end(v));
+      REQUIRE(shp::hex_str(d) == expected);
+
+      ostringstream os;
+      os << shp::hex(d);
+      REQUIRE(os.str() == expected);
+   }
+
+   SECTION("deque of PODs") {
+      struct foo {
+         std::uint8_t a;
+         std::uint8_t b;
+      };
+
+      std::vector<foo> pods;
+      std::deque<foo> d;
+      for (std::size_t i = 0; i < v.size(); i += 2) {
+         pods.push_back({v[i], v[i + 1]});
+         d.push_back({v[i], v[i + 1]});
+      }
+      REQUIRE(shp::hex_str(d) == shp::hex_str(pods));
+   }
+
+   SECTION("list") {
+      std::list<std::uint8_t> l(std::begin(v), std::end(v));
+      REQUIRE(shp::hex_str(l) == expected);
+   }
+}
+
+#if __cplusplus >= 201703L
+TEST_CASE("String views", "[iterator_hex_writer]") {
+   std::string_view v{"0123"};
+   REQUIRE(shp::hex_str(v, shp::NoOffsets{}, shp::NoNibbleSeparation{}, shp::SingleRow{}, shp::NoASCII{})
+           == "30313233");
+}
+#endif
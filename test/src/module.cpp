@@ -0,0 +1,41 @@
+/**
+ * @file   module.cpp
+ * @author Dennis Sitelew
+ * @date   Oct. 18, 2026
+ *
+ * Consumer of the C++20 module, built when the SHP_BUILD_MODULE option is enabled.
+ */
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <vector>
+
+import shp;
+
+TEST_CASE("Module interface", "[module]") {
+   const std::vector<std::uint8_t> v{0xDE, 0xAD, 0xBE, 0xEF};
+
+   SECTION("Strings") {
+      REQUIRE(shp::hex_str(v, shp::NoOffsets{}, shp::NoNibbleSeparation{}, shp::SingleRow{}, shp::NoASCII{})
+              == "DEADBEEF");
+      REQUIRE(shp::hex_str(std::uint16_t{0xA}) == "0x000A");
+
+      std::string out{"> "};
+      shp::append_hex(out, std::uint8_t{0x1F}, shp::NoPrefix{});
+      REQUIRE(out == "> 1F");
+   }
+
+   SECTION("Streams") {
+      std::ostringstream os;
+      os << shp::hex(v);
+      REQUIRE(os.str() == shp::hex_str(v));
+   }
+
+   SECTION("Search and statistics scopes") {
+      const shp::stats::scope scope{"module"};
+      REQUIRE(shp::hex_find(v, shp::hex_pattern("BE EF")).matches() == std::vector<std::size_t>{2});
+   }
+}
@@ -0,0 +1,269 @@
+/**
+ * @file   pcap.cpp
+ * @author Dennis Sitelew
+ * @date   Oct. 18, 2026
+ */
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <shp/pcap.h>
+#include <shp/shp.h>
+
+#include "temp_path.h"
+
+#include <cstdint>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <vector>
+
+using namespace std;
+
+namespace {
+
+//! Builder for capture files with a configurable byte order
+class capture {
+public:
+   explicit capture(bool big_endian = false)
+      : big_endian_{big_endian} {}
+
+   capture &u8(uint8_t v) {
+      bytes_.push_back(v);
+      return *this;
+   }
+
+   capture &u16(uint16_t v) { return number(v, 2); }
+   capture &u32(uint32_t v) { return number(v, 4); }
+
+   capture &data(const vector<uint8_t> &v) {
+      bytes_.insert(bytes_.end(), v.begin(), v.end());
+      return *this;
+   }
+
+   capture &pad() {
+      while (bytes_.size() % 4 != 0) {
+         bytes_.push_back(0);
+      }
+      return *this;
+   }
+
+   //! pcapng block with the body, produced by a callback
+   template <typename Body>
+   capture &block(uint32_t type, Body &&body) {
+      const auto start = bytes_.size();
+      u32(type).u32(0);
+      body(*this);
+      pad();
+
+      const auto length = static_cast<uint32_t>(bytes_.size() - start + 4);
+      u32(length);
+
+      capture patch{big_endian_};
+      patch.u32(length);
+      copy(patch.bytes_.begin(), patch.bytes_.end(), bytes_.begin() + static_cast<ptrdiff_t>(start) + 4);
+      return *this;
+   }
+
+   const vector<uint8_t> &bytes() const { return bytes_; }
+
+   string save(const string &path) const {
+      ofstream out{path, ios::binary};
+      out.write(reinterpret_cast<const char *>(bytes_.data()), static_cast<streamsize>(bytes_.size()));
+      return path;
+   }
+
+private:
+   capture &number(uint64_t v, size_t size) {
+      for (size_t i = 0; i < size; ++i) {
+         const auto shift = 8 * (big_endian_ ? size - 1 - i : i);
+         bytes_.push_back(static_cast<uint8_t>(v >> shift));
+      }
+      return *this;
+   }
+
+private:
+   bool big_endian_;
+   vector<uint8_t> bytes_;
+};
+
+vector<uint8_t> make_packet(size_t size, uint8_t seed) {
+   vector<uint8_t> result(size);
+   for (size_t i = 0; i < size; ++i) {
+      result[i] = static_cast<uint8_t>(seed + i);
+   }
+   return result;
+}
+
+capture classic_capture(bool big_endian, bool nanoseconds, const vector<vector<uint8_t>> &packets) {
+   capture result{big_endian};
+   result.u32(nanoseconds ? 0xA1B23C4D : 0xA1B2C3D4).u16(2).u16(4).u32(0).u32(0).u32(65535).u32(1);
+
+   uint32_t index = 0;
+   for (const auto &p : packets) {
+      result.u32(1700000000 + index).u32(index * 1000 + 5).u32(static_cast<uint32_t>(p.size()));
+      result.u32(static_cast<uint32_t>(p.size()) + (index == 1 ? 10 : 0)).data(p);
+      ++index;
+   }
+   return result;
+}
+
+} // namespace
+
+TEST_CASE("Capture records", "[pcap]") {
+   const auto first = make_packet(20, 0x30);
+   const auto second = make_packet(5, 0x41);
+
+   SECTION("Classic pcap") {
+      const shp_test::temp_path path{"shp_pcap_", ".pcap"};
+      for (const bool big_endian : {false, true}) {
+         const shp::pcap_file file{classic_capture(big_endian, false, {first, second}).save(path.str())};
+
+         shp::pcap_reader reader{file.data(), file.size()};
+         REQUIRE_FALSE(reader.is_pcapng());
+
+         shp::pcap_packet packet;
+         REQUIRE(reader.next(packet));
+         REQUIRE(packet.index == 0);
+         REQUIRE(packet.seconds == 1700000000);
+         REQUIRE(packet.fraction == 5);
+         REQUIRE(packet.fraction_digits == 6);
+         REQUIRE(vector<uint8_t>(packet.data, packet.data + packet.captured) == first);
+
+         REQUIRE(reader.next(packet));
+         REQUIRE(packet.length == 15);
+         REQUIRE(packet.captured == 5);
+         REQUIRE_FALSE(reader.next(packet));
+      }
+   }
+
+   SECTION("pcapng") {
+      capture c{true};
+      c.block(0x0A0D0D0A, [](capture &b) { b.u32(0x1A2B3C4D).u16(1).u16(0).u32(0xFFFFFFFF).u32(0xFFFFFFFF); });
+
+      // Nanosecond resolution with a time offset, and a default (microsecond) interface
+      c.block(1, [](capture &b) {
+         b.u16(1).u16(0).u32(0);
+         b.u16(9).u16(1).u8(9).pad();
+         b.u16(14).u16(8).u32(0).u32(100);
+         b.u16(0).u16(0);
+      });
+      c.block(1, [](capture &b) { b.u16(1).u16(0).u32(0); });
+
+      // Unknown blocks are skipped
+      c.block(0x0BAD, [](capture &b) { b.u32(42); });
+
+      const uint64_t ns = 1700000000ULL * 1000000000ULL + 123;
+      c.block(6, [&](capture &b) {
+         b.u32(0).u32(static_cast<uint32_t>(ns >> 32U)).u32(static_cast<uint32_t>(ns)).u32(20).u32(20).data(first);
+      });
+      c.block(3, [&](capture &b) { b.u32(5).data(second); });
+      c.block(6, [&](capture &b) { b.u32(1).u32(0).u32(2500001).u32(5).u32(60).data(second); });
+
+      const shp_test::temp_path path{"shp_pcap_", ".pcapng"};
+      const shp::pcap_file file{c.save(path.str())};
+      shp::pcap_reader reader{file.data(), file.size()};
+      REQUIRE(reader.is_pcapng());
+
+      shp::pcap_packet packet;
+      REQUIRE(reader.next(packet));
+      REQUIRE(packet.seconds == 1700000100);
+      REQUIRE(packet.fraction == 123);
+      REQUIRE(packet.fraction_digits == 9);
+      REQUIRE(vector<uint8_t>(packet.data, packet.data + packet.captured) == first);
+
+      REQUIRE(reader.next(packet));
+      REQUIRE(packet.index == 1);
+      REQUIRE_FALSE(packet.has_timestamp);
+      REQUIRE(vector<uint8_t>(packet.data, packet.data + packet.captured) == second);
+
+      REQUIRE(reader.next(packet));
+      REQUIRE(packet.seconds == 2);
+      REQUIRE(packet.fraction == 500001);
+      REQUIRE(packet.fraction_digits == 6);
+      REQUIRE(packet.length == 60);
+      REQUIRE_FALSE(reader.next(packet));
+   }
+
+   SECTION("Errors") {
+      const vector<uint8_t> text{'t', 'e', 'x', 't'};
+      REQUIRE_THROWS_AS(shp::pcap_reader(text.data(), text.size()), invalid_argument);
+
+      const shp_test::temp_path path{"shp_pcap_", ".pcap"};
+      capture{}.u32(0xA1B2C3D4).u16(2).u16(4).u32(0).u32(0).u32(65535).u32(1).u32(1).u32(2).u32(100).u32(100)
+         .data(first)
+         .save(path.str());
+      const shp::pcap_file file{path.str()};
+      shp::pcap_reader reader{file.data(), file.size()};
+      shp::pcap_packet packet;
+      REQUIRE_THROWS_AS(reader.next(packet), invalid_argument);
+
+      REQUIRE_THROWS_AS(shp::pcap_file{"shp_missing_capture.pcap"}, system_error);
+   }
+
+   SECTION("Error offsets point to the malformed block") {
+      // A packet block after the 28-byte section header, without an interface description
+      capture c;
+      c.block(0x0A0D0D0A, [](capture &b) { b.u32(0x1A2B3C4D).u16(1).u16(0).u32(0xFFFFFFFF).u32(0xFFFFFFFF); });
+      c.block(6, [&](capture &b) { b.u32(0).u32(0).u32(0).u32(5).u32(5).data(second); });
+
+      shp::pcap_reader reader{c.bytes().data(), c.bytes().size()};
+      shp::pcap_packet packet;
+      REQUIRE_THROWS_WITH(reader.next(packet), "pcap: packet for an unknown interface at offset 28");
+   }
+}
+
+TEST_CASE("Capture dumps", "[pcap]") {
+   const auto first = make_packet(20, 0x30);
+   const auto second = make_packet(5, 0x41);
+   const shp_test::temp_path file{"shp_pcap_", ".pcap"};
+   const auto path = classic_capture(false, true, {first, second, {}}).save(file.str());
+
+   SECTION("Headers and packets") {
+      const auto expected = "Packet 0: time 1700000000.000000005, length 20\n" + shp::hex_str(first) + "\n\n"
+                          + "Packet 1: time 1700000001.000001005, length 15, captured 5\n" + shp::hex_str(second)
+                          + "\n\n" + "Packet 2: time 1700000002.000002005, length 0\n";
+
+      const auto writer = shp::hex_pcap(path);
+      string out;
+      writer.append_to(out);
+      REQUIRE(out == expected);
+      REQUIRE(writer.formatted_size() == expected.size());
+
+      ostringstream os;
+      os << writer;
+      REQUIRE(os.str() == expected);
+   }
+
+   SECTION("Index range and options") {
+      string out;
+      shp::hex_pcap(path, shp::NoOffsets{}, shp::NoNibbleSeparation{}, shp::RowWidth<8>{}, shp::NoASCII{},
+                    shp::LowerCase{})
+         .packets(1, 2)
+         .append_to(out);
+      REQUIRE(out == "Packet 1: time 1700000001.000001005, length 15, captured 5\n4142434445\n");
+   }
+}
+
+TEST_CASE("Parallel capture dumps", "[pcap]") {
+   vector<vector<uint8_t>> packets;
+   for (size_t i = 0; i < 3000; ++i) {
+      packets.push_back(make_packet(i % 1500, static_cast<uint8_t>(i)));
+   }
+   const shp_test::temp_path file{"shp_pcap_", ".pcap"};
+   const auto path = classic_capture(false, false, packets).save(file.str());
+
+   string single;
+   shp::hex_pcap(path).threads(1).append_to(single);
+   REQUIRE(single.size() > (1U << 20U));
+
+   string parallel;
+   shp::hex_pcap(path).threads(8).append_to(parallel);
+   REQUIRE(parallel == single);
+
+   string windows;
+   shp::detail::string_sink sink{windows};
+   shp::hex_pcap(path).threads(3).print_to(sink);
+   REQUIRE(windows == single);
+}
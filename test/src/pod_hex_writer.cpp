@@ -0,0 +1,127 @@
+/**
+ * @file   pod_hex_writer.cpp
+ * @author Dennis Sitelew
+ * @date   Oct. 18, 2026
+ */
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <shp/shp.h>
+
+#include <array>
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <type_traits>
+
+using namespace std;
+
+namespace {
+
+template <size_t N>
+struct blob {
+   uint8_t bytes[N];
+};
+
+template <size_t N>
+blob<N> make_blob() {
+   blob<N> result{};
+   for (size_t i = 0; i < N; ++i) {
+      result.bytes[i] = static_cast<uint8_t>(i * 37U + 0x1FU);
+   }
+   return result;
+}
+
+//! Compare all the outputs of the unrolled writer with the generic one
+template <size_t N, typename... Options>
+void check_object(Options... options) {
+   const auto value = make_blob<N>();
+
+   string expected;
+   shp::iterator_hex_writer<const blob<N> *, Options...>{&value, &value + 1}.append_to(expected);
+
+   const auto writer = shp::pod_hex_writer<blob<N>, Options...>{value};
+   REQUIRE(shp::hex_str(value, options...) == expected);
+   REQUIRE(writer.formatted_size() == expected.size());
+
+   const auto array = writer.to_array();
+   REQUIRE(string(array.data(), array.size()) == expected);
+
+   ostringstream os;
+   os << shp::hex(value, options...);
+   REQUIRE(os.str() == expected);
+
+   string out{"> "};
+   shp::append_hex(out, value, options...);
+   REQUIRE(out == "> " + expected);
+
+   string sunk;
+   shp::detail::string_sink sink{sunk};
+   writer.print_to(sink);
+   REQUIRE(sunk == expected);
+}
+
+template <size_t N>
+void check_all_options() {
+   check_object<N>();
+   check_object<N>(shp::NoOffsets{}, shp::NoNibbleSeparation{}, shp::SingleRow{}, shp::NoASCII{}, shp::LowerCase{});
+   check_object<N>(shp::PrintOffsets{}, shp::SeparateNibbles{}, shp::RowWidth<8>{}, shp::NoASCII{}, shp::LowerCase{});
+   check_object<N>(shp::NoOffsets{}, shp::NoNibbleSeparation{}, shp::RowWidth<5>{}, shp::PrintASCII{});
+   check_object<N>(shp::PrintOffsets{}, shp::SeparateNibbles{}, shp::RowWidth<32>{}, shp::PrintASCII{});
+}
+
+} // namespace
+
+TEST_CASE("Unrolled object printing", "[pod_hex_writer]") {
+   SECTION("Object sizes") {
+      check_all_options<1>();
+      check_all_options<7>();
+      check_all_options<16>();
+      check_all_options<17>();
+      check_all_options<64>();
+      check_all_options<shp::detail::max_unrolled_size>();
+   }
+
+   SECTION("Layout") {
+      struct header {
+         uint8_t magic[4];
+         char name[12];
+         uint8_t flags;
+      } value{{0x7F, 'E', 'L', 'F'}, "firmware", 0xFF};
+
+      // Two rows, the last one padded to the full width
+      static_assert(shp::pod_hex_writer<header>::formatted_size() == 71 + 1 + 56, "Compile time output size");
+      REQUIRE(shp::hex_str(value).substr(0, 24) == "0x00: 7F 45 4C 46 66 69 ");
+      REQUIRE(shp::hex_str(value).substr(53) == "  .ELFfirmware....\n0x10: FF" + string(47, ' ') + ".");
+   }
+
+   SECTION("Offset settings") {
+      // shp::hex returns the same writer type for every object size, the settings switch to the generic formatting
+      const auto value = make_blob<20>();
+      using writer_t = decltype(shp::hex(value));
+      static_assert(std::is_same<writer_t, shp::iterator_hex_writer<const blob<20> *>>::value, "Generic writer");
+
+      auto writer = shp::hex(value);
+      string plain;
+      writer.append_to(plain);
+      REQUIRE(plain == shp::hex_str(value));
+
+      writer.base_offset(0x100);
+      string shifted;
+      writer.append_to(shifted);
+      REQUIRE(shifted.substr(0, 7) == "0x100: ");
+      REQUIRE(shifted.substr(shifted.find('\n') + 1, 7) == "0x110: ");
+      REQUIRE(shifted.size() == writer.formatted_size());
+   }
+
+   SECTION("Large objects use the generic writer") {
+      using large_writer = decltype(shp::hex(make_blob<shp::detail::max_unrolled_size + 1>()));
+      using large_iterator = const blob<shp::detail::max_unrolled_size + 1> *;
+      static_assert(std::is_same<large_writer, shp::iterator_hex_writer<large_iterator>>::value, "Generic writer");
+
+      const auto value = make_blob<shp::detail::max_unrolled_size + 1>();
+      REQUIRE(shp::hex_str(value, shp::NoOffsets{}, shp::NoNibbleSeparation{}, shp::SingleRow{}, shp::NoASCII{})
+              == shp::hex_str(value.bytes, shp::NoOffsets{}, shp::NoNibbleSeparation{}, shp::SingleRow{},
+                              shp::NoASCII{}));
+   }
+}
@@ -0,0 +1,187 @@
+/**
+ * @file   stats.cpp
+ * @author Dennis Sitelew
+ * @date   Oct. 18, 2026
+ */
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <shp/pcap.h>
+#include <shp/shp.h>
+
+#include "temp_path.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if !defined(SHP_ENABLE_STATS)
+#error "The statistics tests should be compiled with SHP_ENABLE_STATS"
+#endif
+
+using namespace std;
+
+namespace {
+
+shp::stats::call_site_stats find_site(const std::string &site) {
+   const auto all = shp::stats::snapshot();
+   auto it = std::find_if(all.begin(), all.end(), [&](const shp::stats::call_site_stats &s) { return s.site == site; });
+   REQUIRE(it != all.end());
+   return *it;
+}
+
+} // namespace
+
+TEST_CASE("Statistics are aggregated per call site", "[stats]") {
+   shp::stats::reset();
+
+   std::vector<std::uint8_t> v(32);
+
+   {
+      SHP_STATS_TAG("strings");
+      auto str = shp::hex_str(v);
+      str += shp::hex_str(std::uint32_t{1});
+   }
+
+   {
+      SHP_STATS_TAG("streams");
+      ostringstream os;
+      os << shp::hex(v, shp::NoOffsets{}, shp::NoNibbleSeparation{}, shp::SingleRow{}, shp::NoASCII{});
+      os << shp::hex(std::uint16_t{1}, shp::NoPrefix{}, shp::NoFill{});
+      REQUIRE(os.str().size() == 65);
+   }
+
+   const auto strings = find_site("strings");
+   REQUIRE(strings.calls == 2);
+   REQUIRE(strings.input_bytes == 32 + 4);
+   REQUIRE(strings.output_chars == shp::hex(v).formatted_size() + 10);
+   REQUIRE(strings.allocations >= 1); // Short integral strings may fit into the small string buffer
+
+   const auto streams = find_site("streams");
+   REQUIRE(streams.calls == 2);
+   REQUIRE(streams.input_bytes == 32 + 2);
+   REQUIRE(streams.output_chars == 65);
+   REQUIRE(streams.allocations == 0);
+}
+
+TEST_CASE("Statistics are collected from all threads", "[stats]") {
+   shp::stats::reset();
+   const auto running = [] {
+      auto &reg = shp::stats::detail::get_registry();
+      std::lock_guard<std::mutex> lock{reg.mutex};
+      return reg.blocks.size();
+   };
+   const auto blocks = running();
+
+   std::vector<std::thread> threads;
+   for (int i = 0; i < 4; ++i) {
+      threads.emplace_back([] {
+         SHP_STATS_TAG("threads");
+         std::string str;
+         for (int j = 0; j < 100; ++j) {
+            shp::hex_str_into(str, std::uint64_t{42});
+         }
+      });
+   }
+
+   for (auto &t : threads) {
+      t.join();
+   }
+
+   // The exited threads are merged into the retired totals
+   REQUIRE(running() == blocks);
+
+   const auto stats = find_site("threads");
+   REQUIRE(stats.calls == 400);
+   REQUIRE(stats.input_bytes == 400 * 8);
+   REQUIRE(stats.output_chars == 400 * 18);
+
+   shp::stats::reset();
+   const auto all = shp::stats::snapshot();
+   REQUIRE(std::all_of(all.begin(), all.end(), [](const shp::stats::call_site_stats &s) { return s.calls == 0; }));
+}
+
+TEST_CASE("Call site tags are copied", "[stats]") {
+   shp::stats::reset();
+
+   // Equal tags at different addresses share the statistics, the tag strings may be gone before the snapshot
+   for (int i = 0; i < 2; ++i) {
+      const std::string tag{"dynamic tag, longer than the small string buffer"};
+      const shp::stats::scope scope{tag.c_str()};
+      shp::hex_str(std::uint8_t{1});
+   }
+
+   {
+      const shp::stats::scope scope{std::string{"dynamic tag, longer than the small string buffer"}};
+      shp::hex_str(std::uint8_t{1});
+   }
+
+   REQUIRE(find_site("dynamic tag, longer than the small string buffer").calls == 3);
+
+   // Calls outside of any scope
+   shp::hex_str(std::uint8_t{1});
+   REQUIRE(find_site("<unknown>").calls == 1);
+}
+
+TEST_CASE("File and line call sites", "[stats]") {
+   shp::stats::reset();
+
+   SHP_STATS_SITE();
+   const auto expected = std::string{__FILE__} + ":" + std::to_string(__LINE__ - 1);
+   shp::hex_str(std::uint8_t{1});
+
+   REQUIRE(find_site(expected).calls == 1);
+}
+
+TEST_CASE("Dump cursor steps", "[stats]") {
+   shp::stats::reset();
+
+   std::vector<std::uint8_t> v(100);
+   std::string out;
+   {
+      SHP_STATS_TAG("cursor");
+      auto cursor = shp::hex_cursor(v);
+      while (cursor.step(out, 7)) {
+         // Nothing to do here
+      }
+   }
+
+   const auto stats = find_site("cursor");
+   REQUIRE(stats.calls == 15);
+   REQUIRE(stats.input_bytes == 100);
+   REQUIRE(stats.output_chars == out.size());
+}
+
+TEST_CASE("Capture dumps are recorded as a single call", "[stats]") {
+   const shp_test::temp_path file{"shp_stats_", ".pcap"};
+
+   // Classic little-endian capture with two 4-byte packets
+   const std::uint8_t capture[] = {
+      0xD4, 0xC3, 0xB2, 0xA1, 2, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0xFF, 0xFF, 0, 0, 1, 0, 0, 0, // File header
+      1,    0,    0,    0,    0, 0, 0, 0, 4, 0, 0, 0, 4, 0, 0, 0, 0xDE, 0xAD, 0xBE, 0xEF,       // First packet
+      2,    0,    0,    0,    0, 0, 0, 0, 4, 0, 0, 0, 4, 0, 0, 0, 0x01, 0x02, 0x03, 0x04,       // Second packet
+   };
+   std::ofstream{file.str(), std::ios::binary}.write(reinterpret_cast<const char *>(capture), sizeof(capture));
+
+   shp::stats::reset();
+   std::string out;
+   {
+      SHP_STATS_TAG("pcap");
+      shp::hex_pcap(file.str()).append_to(out);
+
+      std::ostringstream os;
+      os << shp::hex_pcap(file.str());
+      REQUIRE(os.str() == out);
+   }
+
+   // The packets are formatted as a part of the dump, not as separate calls
+   const auto stats = find_site("pcap");
+   REQUIRE(stats.calls == 2);
+   REQUIRE(stats.input_bytes == 2 * 8);
+   REQUIRE(stats.output_chars == 2 * out.size());
+}
@@ -0,0 +1,47 @@
+/**
+ * @file   temp_path.h
+ * @author Dennis Sitelew
+ * @date   Oct. 18, 2026
+ *
+ * Temporary files of the tests.
+ */
+#ifndef SIMPLE_HEX_PRINTER_TEST_SRC_TEMP_PATH_H
+#define SIMPLE_HEX_PRINTER_TEST_SRC_TEMP_PATH_H
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <string>
+
+namespace shp_test {
+
+//! Unique path of a temporary file, the file is removed when the object goes out of scope
+class temp_path {
+public:
+   /**
+    * Constructor
+    * @param prefix File name prefix
+    * @param extension File name extension, including the dot
+    */
+   temp_path(const std::string &prefix, const std::string &extension) {
+      std::random_device device;
+      const auto seed = static_cast<std::uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+      const auto value = (static_cast<std::uint64_t>(device()) << 32U | device()) ^ seed;
+      path_ = prefix + std::to_string(value) + extension;
+   }
+
+   ~temp_path() { std::remove(path_.c_str()); }
+
+   temp_path(const temp_path &) = delete;
+   temp_path &operator=(const temp_path &) = delete;
+
+   const std::string &str() const { return path_; }
+
+private:
+   std::string path_;
+};
+
+} // namespace shp_test
+
+#endif /* SIMPLE_HEX_PRINTER_TEST_SRC_TEMP_PATH_H */
@@ -0,0 +1,34 @@
+#!/usr/bin/env bash
+#
+# Compare the shp-dump throughput with xxd.
+#
+# Usage: bench_shp_dump.sh <path-to-shp-dump> [size-in-MiB]
+#
+set -euo pipefail
+
+SHP_DUMP=${1:?"Usage: $0 <path-to-shp-dump> [size-in-MiB]"}
+SIZE_MIB=${2:-1024}
+
+WORK_DIR=$(mktemp -d)
+trap 'rm -rf "${WORK_DIR}"' EXIT
+
+INPUT="${WORK_DIR}/input.bin"
+echo "Generating ${SIZE_MIB} MiB of random data..."
+head -c "$((SIZE_MIB * 1024 * 1024))" /dev/urandom > "${INPUT}"
+
+# Print the wall clock time of a command in seconds, discarding its output
+measure() {
+   local start end
+   start=$(date +%s%N)
+   "$@" > /dev/null
+   end=$(date +%s%N)
+   awk "BEGIN { printf \"%.3f\", (${end} - ${start}) / 1e9 }"
+}
+
+printf "%-32s %10s\n" "Command" "Seconds"
+printf "%-32s %10s\n" "xxd" "$(measure xxd "${INPUT}")"
+printf "%-32s %10s\n" "shp-dump" "$(measure "${SHP_DUMP}" "${INPUT}")"
+printf "%-32s %10s\n" "xxd -i" "$(measure xxd -i "${INPUT}")"
+printf "%-32s %10s\n" "shp-dump -i" "$(measure "${SHP_DUMP}" -i "${INPUT}")"
+printf "%-32s %10s\n" "xxd (stdin)" "$(measure sh -c "xxd < '${INPUT}'")"
+printf "%-32s %10s\n" "shp-dump (stdin)" "$(measure sh -c "'${SHP_DUMP}' < '${INPUT}'")"
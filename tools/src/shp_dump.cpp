@@ -0,0 +1,768 @@
+/**
+ * @file   shp_dump.cpp
+ * @author Dennis Sitelew
+ * @date   Oct. 18, 2026
+ *
+ * Command line tool for dumping files (or the standard input) with the same output format as the library.
+ */
+
+#include <shp/pcap.h>
+#include <shp/shp.h>
+
+#if !defined(_WIN32)
+#include <shp/async_writer.h>
+#endif
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#if defined(_WIN32)
+#include <fcntl.h>
+#include <io.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+////////////////////////////////////////////////////////////////////////////////
+/// Command line options
+////////////////////////////////////////////////////////////////////////////////
+struct options {
+   std::string path{"-"};
+   std::string output;
+
+   std::uint64_t offset{0};
+   std::uint64_t length{std::numeric_limits<std::uint64_t>::max()};
+
+   std::size_t width{16};
+   bool width_set{false};
+
+   bool offsets{true};
+   bool separate_nibbles{true};
+   bool ascii{true};
+   bool upper_case{true};
+   bool single_row{false};
+
+   bool c_array{false};
+   bool prefix{true};
+   std::string name;
+
+   bool find{false};
+   std::string pattern;
+   std::size_t context{0};
+
+   bool pcap{false};
+   std::size_t first_packet{0};
+   std::size_t last_packet{std::numeric_limits<std::size_t>::max()};
+   std::size_t threads{0};
+};
+
+void print_usage(std::ostream &os) {
+   os << "Usage: shp-dump [options] [file]\n"
+         "Dump a file (or the standard input if no file or '-' is given) in HEX.\n"
+         "\n"
+         "Options:\n"
+         "  -s, --offset N      Skip N bytes from the start of the input\n"
+         "  -l, --length N      Dump at most N bytes\n"
+         "  -w, --width N       Bytes per row: 4, 8, 12, 16 (default), 24, 32, 48 or 64\n"
+         "  -1, --single-row    Print all bytes in a single row, implies --no-offsets and --no-ascii\n"
+         "      --no-offsets    Don't print row offsets\n"
+         "      --no-separation Don't separate bytes with spaces\n"
+         "      --no-ascii      Don't print ASCII values\n"
+         "      --lower         Print HEX values in lower case\n"
+         "      --upper         Print HEX values in upper case\n"
+         "  -i, --c-array       Print a C-array initializer (xxd -i compatible), 12 bytes per row and\n"
+         "                      lower case by default\n"
+         "  -n, --name NAME     Array name for the C-array output, if not set - only the values are printed\n"
+         "      --no-prefix     Don't add the 0x prefix to the C-array values\n"
+         "  -f, --find HEX      Print only the rows with the HEX byte pattern (e.g. 'DE AD BE EF'), the matches are\n"
+         "                      highlighted when writing to a terminal\n"
+         "  -C, --context N     Number of rows to print before and after the rows with matches\n"
+         "  -p, --pcap          Dump the packets of a pcap or pcapng capture file, each with a header line\n"
+         "      --packets A[:B] Dump only the packets with indices from A up to (but not including) B\n"
+         "  -j, --threads N     Number of threads for formatting captures, all hardware threads by default\n"
+#if !defined(_WIN32)
+         "  -o, --output FILE   Write the output into FILE with asynchronous I/O instead of the standard output\n"
+#endif
+         "  -h, --help          Print this help message\n"
+         "\n"
+         "Numeric arguments can be given in decimal or in HEX with the 0x prefix.\n";
+}
+
+std::uint64_t parse_number(const std::string &option, const std::string &value) {
+   try {
+      std::size_t pos = 0;
+      const auto result = std::stoull(value, &pos, 0);
+      if (pos == value.size()) {
+         return result;
+      }
+   } catch (const std::exception &) {
+      // Reported below
+   }
+   throw std::invalid_argument{"Invalid numeric value for " + option + ": '" + value + "'"};
+}
+
+options parse_options(int argc, char **argv) {
+   options result;
+   bool case_set = false;
+   bool path_set = false;
+
+   for (int i = 1; i < argc; ++i) {
+      const std::string arg{argv[i]};
+
+      auto value = [&]() -> std::string {
+         if (i + 1 >= argc) {
+            throw std::invalid_argument{"Missing value for " + arg};
+         }
+         return argv[++i];
+      };
+
+      if (arg == "-h" || arg == "--help") {
+         print_usage(std::cout);
+         std::exit(EXIT_SUCCESS);
+      } else if (arg == "-s" || arg == "--offset") {
+         result.offset = parse_number(arg, value());
+      } else if (arg == "-l" || arg == "--length") {
+         result.length = parse_number(arg, value());
+      } else if (arg == "-w" || arg == "--width") {
+         result.width = static_cast<std::size_t>(parse_number(arg, value()));
+         result.width_set = true;
+      } else if (arg == "-1" || arg == "--single-row") {
+         result.single_row = true;
+      } else if (arg == "--no-offsets") {
+         result.offsets = false;
+      } else if (arg == "--no-separation") {
+         result.separate_nibbles = false;
+      } else if (arg == "--no-ascii") {
+         result.ascii = false;
+      } else if (arg == "--lower") {
+         result.upper_case = false;
+         case_set = true;
+      } else if (arg == "--upper") {
+         result.upper_case = true;
+         case_set = true;
+      } else if (arg == "-i" || arg == "--c-array") {
+         result.c_array = true;
+      } else if (arg == "-n" || arg == "--name") {
+         result.name = value();
+      } else if (arg == "--no-prefix") {
+         result.prefix = false;
+      } else if (arg == "-f" || arg == "--find") {
+         result.find = true;
+         result.pattern = shp::hex_pattern(value());
+      } else if (arg == "-C" || arg == "--context") {
+         result.context = static_cast<std::size_t>(parse_number(arg, value()));
+      } else if (arg == "-p" || arg == "--pcap") {
+         result.pcap = true;
+      } else if (arg == "--packets") {
+         const auto range = value();
+         const auto colon = range.find(':');
+         result.first_packet = static_cast<std::size_t>(parse_number(arg, range.substr(0, colon)));
+         if (colon != std::string::npos) {
+            result.last_packet = static_cast<std::size_t>(parse_number(arg, range.substr(colon + 1)));
+         }
+      } else if (arg == "-j" || arg == "--threads") {
+         result.threads = static_cast<std::size_t>(parse_number(arg, value()));
+#if !defined(_WIN32)
+      } else if (arg == "-o" || arg == "--output") {
+         result.output = value();
+#endif
+      } else if (arg.size() > 1 && arg[0] == '-') {
+         throw std::invalid_argument{"Unknown option: " + arg};
+      } else if (!path_set) {
+         result.path = arg;
+         path_set = true;
+      } else {
+         throw std::invalid_argument{"Only a single input file is supported"};
+      }
+   }
+
+   if (result.c_array) {
+      // Match the xxd -i defaults
+      if (!result.width_set) {
+         result.width = 12;
+      }
+      if (!case_set) {
+         result.upper_case = false;
+      }
+   }
+
+   const std::size_t widths[] = {4, 8, 12, 16, 24, 32, 48, 64};
+   if (std::find(std::begin(widths), std::end(widths), result.width) == std::end(widths)) {
+      throw std::invalid_argument{"Unsupported row width: " + std::to_string(result.width)};
+   }
+
+   if (result.single_row) {
+      result.offsets = false;
+      result.ascii = false;
+   }
+
+   if (result.find && (result.c_array || result.single_row || result.offset != 0)) {
+      throw std::invalid_argument{"--find cannot be combined with --c-array, --single-row or --offset"};
+   }
+
+   if (result.pcap) {
+      const bool window = result.offset != 0 || result.length != std::numeric_limits<std::uint64_t>::max();
+      if (result.c_array || result.find || window) {
+         throw std::invalid_argument{"--pcap cannot be combined with --c-array, --find, --offset or --length"};
+      }
+      if (result.path == "-") {
+         throw std::invalid_argument{"--pcap requires an input file"};
+      }
+   }
+
+   return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Input
+////////////////////////////////////////////////////////////////////////////////
+
+//! Input bytes, memory-mapped for regular files and read in chunks otherwise (e.g. from a pipe)
+class input {
+public:
+   explicit input(const std::string &path)
+      : name_{path == "-" ? "<stdin>" : path} {
+      if (path == "-") {
+         fd_ = fileno(stdin);
+#if defined(_WIN32)
+         _setmode(fd_, _O_BINARY);
+#endif
+         return;
+      }
+
+#if defined(_WIN32)
+      fd_ = _open(path.c_str(), _O_RDONLY | _O_BINARY);
+#else
+      fd_ = ::open(path.c_str(), O_RDONLY);
+#endif
+      if (fd_ < 0) {
+         throw std::runtime_error{"Error opening " + path + ": " + std::strerror(errno)};
+      }
+      owns_fd_ = true;
+
+      if (map()) {
+         close_fd();
+      }
+   }
+
+   ~input() {
+#if !defined(_WIN32)
+      if (mapped_ != nullptr) {
+         ::munmap(mapped_, size_);
+      }
+#endif
+      close_fd();
+   }
+
+   input(const input &) = delete;
+   input &operator=(const input &) = delete;
+
+public:
+   //! Whether the whole input is available through data() and size()
+   bool mapped() const { return mapped_ != nullptr; }
+
+   const std::uint8_t *data() const { return data_; }
+   std::size_t size() const { return size_; }
+
+   /**
+    * Read the next part of an input, which is not mapped.
+    * @param out Output buffer
+    * @param size Maximal number of bytes to read
+    * @return Number of bytes read, 0 at the end of the input
+    */
+   std::size_t read(std::uint8_t *out, std::size_t size) {
+      for (;;) {
+#if defined(_WIN32)
+         const auto count = _read(fd_, out, static_cast<unsigned>(size));
+#else
+         const auto count = ::read(fd_, out, size);
+#endif
+         if (count >= 0) {
+            return static_cast<std::size_t>(count);
+         }
+
+         if (errno != EINTR) {
+            throw std::runtime_error{"Error reading " + name_ + ": " + std::strerror(errno)};
+         }
+      }
+   }
+
+private:
+   void close_fd() {
+      if (!owns_fd_) {
+         return;
+      }
+      owns_fd_ = false;
+
+#if defined(_WIN32)
+      _close(fd_);
+#else
+      ::close(fd_);
+#endif
+   }
+
+   bool map() {
+#if defined(_WIN32)
+      return false;
+#else
+      struct stat st {};
+      if (::fstat(fd_, &st) != 0 || !S_ISREG(st.st_mode) || st.st_size == 0) {
+         return false;
+      }
+
+      const auto size = static_cast<std::size_t>(st.st_size);
+      void *mapped = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd_, 0);
+      if (mapped == MAP_FAILED) {
+         return false;
+      }
+
+      ::madvise(mapped, size, MADV_SEQUENTIAL);
+      mapped_ = mapped;
+      size_ = size;
+      data_ = static_cast<const std::uint8_t *>(mapped_);
+      return true;
+#endif
+   }
+
+private:
+   std::string name_;
+   int fd_{-1};
+   bool owns_fd_{false};
+
+   void *mapped_{nullptr};
+   const std::uint8_t *data_{nullptr};
+   std::size_t size_{0};
+};
+
+////////////////////////////////////////////////////////////////////////////////
+/// Output
+////////////////////////////////////////////////////////////////////////////////
+
+//! Library sink, passing the output to the standard output in large blocks
+class stdout_sink {
+public:
+   stdout_sink()
+      : buffer_(1U << 20U) {
+#if defined(_WIN32)
+      _setmode(_fileno(stdout), _O_BINARY);
+#endif
+   }
+
+public:
+   void put(char c) {
+      if (used_ == buffer_.size()) {
+         flush();
+      }
+      buffer_[used_++] = c;
+   }
+
+   void write(const char *data, std::size_t size) {
+      if (size > buffer_.size() - used_) {
+         flush();
+         if (size >= buffer_.size()) {
+            write_out(data, size);
+            return;
+         }
+      }
+      std::memcpy(buffer_.data() + used_, data, size);
+      used_ += size;
+   }
+
+   char *acquire(std::size_t size) {
+      if (size > buffer_.size() - used_) {
+         flush();
+      }
+      return buffer_.data() + used_;
+   }
+
+   void commit(char *end) { used_ = static_cast<std::size_t>(end - buffer_.data()); }
+
+   void flush() {
+      write_out(buffer_.data(), used_);
+      used_ = 0;
+   }
+
+private:
+   static void write_out(const char *data, std::size_t size) {
+      while (size != 0) {
+#if defined(_WIN32)
+         const auto count = _write(_fileno(stdout), data, static_cast<unsigned>(size));
+#else
+         const auto count = ::write(STDOUT_FILENO, data, size);
+#endif
+         if (count < 0) {
+            if (errno == EINTR) {
+               continue;
+            }
+            throw std::runtime_error{std::string{"Error writing output: "} + std::strerror(errno)};
+         }
+         data += count;
+         size -= static_cast<std::size_t>(count);
+      }
+   }
+
+private:
+   std::vector<char> buffer_;
+   std::size_t used_{0};
+};
+
+////////////////////////////////////////////////////////////////////////////////
+/// Mapping runtime options to format specifiers
+////////////////////////////////////////////////////////////////////////////////
+template <typename OnTrue, typename OnFalse, typename Fn>
+void select(bool value, Fn &&fn) {
+   if (value) {
+      fn(OnTrue{});
+   } else {
+      fn(OnFalse{});
+   }
+}
+
+template <typename Fn>
+void select_width(std::size_t width, Fn &&fn) {
+   switch (width) {
+      case 4:
+         return fn(shp::RowWidth<4>{});
+      case 8:
+         return fn(shp::RowWidth<8>{});
+      case 12:
+         return fn(shp::RowWidth<12>{});
+      case 16:
+         return fn(shp::RowWidth<16>{});
+      case 24:
+         return fn(shp::RowWidth<24>{});
+      case 32:
+         return fn(shp::RowWidth<32>{});
+      case 48:
+         return fn(shp::RowWidth<48>{});
+      case 64:
+         return fn(shp::RowWidth<64>{});
+      default:
+         throw std::invalid_argument{"Unsupported row width: " + std::to_string(width)};
+   }
+}
+
+using iterator_t = const std::uint8_t *;
+
+//! Dump the bytes in HEX, `base` is the input offset of the first byte, `offset_width` - minimal offset width
+template <typename Sink>
+void dump_hex(const options &opts,
+              iterator_t first,
+              iterator_t last,
+              std::size_t base,
+              std::size_t offset_width,
+              Sink &sink) {
+   if (opts.single_row) {
+      select<shp::SeparateNibbles, shp::NoNibbleSeparation>(opts.separate_nibbles, [&](auto separation) {
+         select<shp::UpperCase, shp::LowerCase>(opts.upper_case, [&](auto letter_case) {
+            shp::iterator_hex_writer<iterator_t, shp::NoOffsets, decltype(separation), shp::SingleRow, shp::NoASCII,
+                                     decltype(letter_case)>{first, last}
+               .print_to(sink);
+         });
+      });
+      return;
+   }
+
+   select<shp::PrintOffsets, shp::NoOffsets>(opts.offsets, [&](auto offsets) {
+      select<shp::SeparateNibbles, shp::NoNibbleSeparation>(opts.separate_nibbles, [&](auto separation) {
+         select_width(opts.width, [&](auto width) {
+            select<shp::PrintASCII, shp::NoASCII>(opts.ascii, [&](auto ascii) {
+               select<shp::UpperCase, shp::LowerCase>(opts.upper_case, [&](auto letter_case) {
+                  shp::iterator_hex_writer<iterator_t, decltype(offsets), decltype(separation), decltype(width),
+                                           decltype(ascii), decltype(letter_case)>{first, last}
+                     .base_offset(base)
+                     .offset_width(offset_width)
+                     .print_to(sink);
+               });
+            });
+         });
+      });
+   });
+}
+
+template <typename Sink>
+void dump_c_array(const options &opts, iterator_t first, iterator_t last, Sink &sink) {
+   select<shp::Prefix, shp::NoPrefix>(opts.prefix, [&](auto prefix) {
+      select_width(opts.width, [&](auto width) {
+         select<shp::UpperCase, shp::LowerCase>(opts.upper_case, [&](auto letter_case) {
+            shp::c_array_writer<iterator_t, decltype(prefix), decltype(width), decltype(letter_case)>{first, last,
+                                                                                                    opts.name}
+               .print_to(sink);
+         });
+      });
+   });
+}
+
+bool stdout_is_terminal() {
+#if defined(_WIN32)
+   return _isatty(_fileno(stdout)) != 0;
+#else
+   return ::isatty(STDOUT_FILENO) != 0;
+#endif
+}
+
+template <typename Sink>
+void dump_find(const options &opts, iterator_t first, iterator_t last, Sink &sink) {
+   // Escape sequences are only useful on a terminal, not in files or pipes
+   const bool highlight = opts.output.empty() && stdout_is_terminal();
+
+   select<shp::PrintOffsets, shp::NoOffsets>(opts.offsets, [&](auto offsets) {
+      select<shp::SeparateNibbles, shp::NoNibbleSeparation>(opts.separate_nibbles, [&](auto separation) {
+         select_width(opts.width, [&](auto width) {
+            select<shp::PrintASCII, shp::NoASCII>(opts.ascii, [&](auto ascii) {
+               select<shp::UpperCase, shp::LowerCase>(opts.upper_case, [&](auto letter_case) {
+                  select<shp::HighlightMatches, shp::NoHighlight>(highlight, [&](auto highlighting) {
+                     const shp::hex_match_writer<iterator_t, decltype(offsets), decltype(separation),
+                                                 decltype(width), decltype(ascii), decltype(letter_case),
+                                                 decltype(highlighting)>
+                        writer{first, last, opts.pattern, opts.context};
+
+                     writer.print_to(sink);
+                     if (writer.has_matches()) {
+                        sink.put('\n');
+                     }
+                  });
+               });
+            });
+         });
+      });
+   });
+}
+
+template <typename Sink>
+void dump_pcap_packets(const options &opts, Sink &sink) {
+   const auto file = std::make_shared<const shp::pcap_file>(opts.path);
+
+   auto print = [&](auto writer) {
+      writer.packets(opts.first_packet, opts.last_packet).threads(opts.threads).print_to(sink);
+   };
+
+   if (opts.single_row) {
+      select<shp::SeparateNibbles, shp::NoNibbleSeparation>(opts.separate_nibbles, [&](auto separation) {
+         select<shp::UpperCase, shp::LowerCase>(opts.upper_case, [&](auto letter_case) {
+            print(shp::pcap_dump_writer<shp::NoOffsets, decltype(separation), shp::SingleRow, shp::NoASCII,
+                                        decltype(letter_case)>{file});
+         });
+      });
+      return;
+   }
+
+   select<shp::PrintOffsets, shp::NoOffsets>(opts.offsets, [&](auto offsets) {
+      select<shp::SeparateNibbles, shp::NoNibbleSeparation>(opts.separate_nibbles, [&](auto separation) {
+         select_width(opts.width, [&](auto width) {
+            select<shp::PrintASCII, shp::NoASCII>(opts.ascii, [&](auto ascii) {
+               select<shp::UpperCase, shp::LowerCase>(opts.upper_case, [&](auto letter_case) {
+                  print(shp::pcap_dump_writer<decltype(offsets), decltype(separation), decltype(width),
+                                              decltype(ascii), decltype(letter_case)>{file});
+               });
+            });
+         });
+      });
+   });
+}
+
+template <typename Sink>
+void dump_pcap(const options &opts, Sink &sink) {
+   try {
+      dump_pcap_packets(opts, sink);
+   } catch (const std::invalid_argument &e) {
+      // Malformed captures are not usage errors
+      throw std::runtime_error{opts.path + ": " + e.what()};
+   }
+}
+
+template <typename Sink>
+void dump(const options &opts,
+          iterator_t first,
+          iterator_t last,
+          std::size_t base,
+          std::size_t offset_width,
+          Sink &sink) {
+   if (opts.c_array) {
+      dump_c_array(opts, first, last, sink);
+   } else if (opts.find) {
+      dump_find(opts, first, last, sink);
+   } else {
+      dump_hex(opts, first, last, base, offset_width, sink);
+      if (first != last) {
+         sink.put('\n');
+      }
+   }
+}
+
+//! Number of HEX digits in the offsets of a window, ending at `end`
+std::size_t offset_digits(std::uint64_t end) {
+   std::size_t result = 0;
+   for (auto reminder = end == 0 ? 0 : end - 1; reminder != 0; reminder /= 16) {
+      ++result;
+   }
+   return result;
+}
+
+//! Size of the parts, a stream is dumped in
+constexpr std::size_t chunk_size = 1U << 20U;
+
+/**
+ * Minimal offset width of a window, larger than a single chunk. A stream is printed before its end is known, so such
+ * windows use a fixed width for files and streams alike: the digits of the window end with -l, or enough digits for
+ * any 64-bit offset otherwise. Windows up to a chunk are printed exactly like the library does.
+ */
+std::size_t large_window_offset_width(const options &opts) {
+   const auto max = std::numeric_limits<std::uint64_t>::max();
+   if (opts.length == max) {
+      return 2 * sizeof(std::uint64_t);
+   }
+   return offset_digits(opts.length < max - opts.offset ? opts.offset + opts.length : max);
+}
+
+//! Dump an input, which is not mapped, in chunks, so that the memory use doesn't depend on the input size
+template <typename Sink>
+void dump_stream(const options &opts, input &in, Sink &sink) {
+   // One more byte, to tell if the window is larger than a chunk before printing it
+   std::vector<std::uint8_t> buffer(chunk_size + 1);
+
+   std::uint64_t base = 0;
+   while (base < opts.offset) {
+      const auto skip = std::min<std::uint64_t>(opts.offset - base, chunk_size);
+      const auto count = in.read(buffer.data(), static_cast<std::size_t>(skip));
+      if (count == 0) {
+         break;
+      }
+      base += count;
+   }
+
+   // Read until the buffer is full, stopping at the end of the window or of the input
+   std::uint64_t remaining = opts.length;
+   auto fill = [&](std::size_t used) {
+      while (used != buffer.size() && remaining != 0) {
+         const auto size = std::min<std::uint64_t>(buffer.size() - used, remaining);
+         const auto count = in.read(buffer.data() + used, static_cast<std::size_t>(size));
+         if (count == 0) {
+            remaining = 0;
+            break;
+         }
+         used += count;
+         remaining -= count;
+      }
+      return used;
+   };
+
+   std::size_t used = fill(0);
+   if (opts.c_array || opts.find) {
+      // The array length is a part of the output and the matches may span chunks, so the whole window is read first
+      while (remaining != 0) {
+         buffer.resize(used + chunk_size);
+         used = fill(used);
+      }
+      dump(opts, buffer.data(), buffer.data() + used, 0, 0, sink);
+      return;
+   }
+
+   // The offset width should stay the same for all the chunks
+   const auto offset_width = used > chunk_size ? large_window_offset_width(opts) : 0;
+
+   // Every chunk but the last one ends with a complete row, the rest of the row is moved to the next chunk
+   const std::size_t row = opts.single_row ? 1 : opts.width;
+   bool first_chunk = true;
+   while (used != 0) {
+      const bool last_chunk = remaining == 0;
+      const auto size = last_chunk ? used : used - used % row;
+
+      if (!first_chunk) {
+         if (!opts.single_row) {
+            sink.put('\n');
+         } else if (opts.separate_nibbles) {
+            sink.put(' ');
+         }
+      }
+      first_chunk = false;
+
+      dump_hex(opts, buffer.data(), buffer.data() + size, static_cast<std::size_t>(base), offset_width, sink);
+      base += size;
+
+      std::memmove(buffer.data(), buffer.data() + size, used - size);
+      used = last_chunk ? 0 : fill(used - size);
+   }
+
+   if (!first_chunk) {
+      sink.put('\n');
+   }
+}
+
+template <typename Sink>
+void dump_input(const options &opts, input &in, Sink &sink) {
+   if (!in.mapped()) {
+      dump_stream(opts, in, sink);
+      return;
+   }
+
+   const auto offset = opts.offset < in.size() ? static_cast<std::size_t>(opts.offset) : in.size();
+   const auto available = in.size() - offset;
+   const auto length = opts.length < available ? static_cast<std::size_t>(opts.length) : available;
+
+   const auto first = in.data() + offset;
+   dump(opts, first, first + length, offset, length > chunk_size ? large_window_offset_width(opts) : 0, sink);
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+   try {
+      const auto opts = parse_options(argc, argv);
+      if (opts.pcap) {
+#if !defined(_WIN32)
+         if (!opts.output.empty()) {
+            shp::async_file_writer sink{opts.output};
+            dump_pcap(opts, sink);
+            sink.close();
+            return EXIT_SUCCESS;
+         }
+#endif
+
+         stdout_sink sink;
+         dump_pcap(opts, sink);
+         sink.flush();
+         return EXIT_SUCCESS;
+      }
+
+      input in{opts.path};
+
+#if !defined(_WIN32)
+      if (!opts.output.empty()) {
+         // Formatting continues into the next buffer while the previous one is being written
+         shp::async_file_writer sink{opts.output};
+         dump_input(opts, in, sink);
+         sink.close();
+         return EXIT_SUCCESS;
+      }
+#endif
+
+      stdout_sink sink;
+      dump_input(opts, in, sink);
+      sink.flush();
+   } catch (const std::invalid_argument &e) {
+      std::cerr << "shp-dump: " << e.what() << "\n\n";
+      print_usage(std::cerr);
+      return EXIT_FAILURE;
+   } catch (const std::exception &e) {
+      std::cerr << "shp-dump: " << e.what() << std::endl;
+      return EXIT_FAILURE;
+   }
+   return EXIT_SUCCESS;
+}
@@ -0,0 +1,36 @@
+# Check the shp-dump pattern search: the matching rows are printed without escape sequences, unless the output is a
+# terminal.
+#
+# Usage: cmake -DSHP_DUMP=<path-to-shp-dump> -DWORK_DIR=<directory> -P shp_dump_find.cmake
+
+if(NOT SHP_DUMP OR NOT WORK_DIR)
+   message(FATAL_ERROR "SHP_DUMP and WORK_DIR should be set")
+endif()
+
+set(input "${WORK_DIR}/shp_dump_find.bin")
+file(WRITE "${input}"
+   "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/"
+   "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/"
+)
+
+set(expected
+   "0x00: 41 42 43 44 45 46 47 48 49 4A 4B 4C 4D 4E 4F 50  ABCDEFGHIJKLMNOP\n"
+   "0x10: 51 52 53 54 55 56 57 58 59 5A 61 62 63 64 65 66  QRSTUVWXYZabcdef\n"
+   "--\n"
+   "0x30: 77 78 79 7A 30 31 32 33 34 35 36 37 38 39 2B 2F  wxyz0123456789+/\n"
+   "0x40: 41 42 43 44 45 46 47 48 49 4A 4B 4C 4D 4E 4F 50  ABCDEFGHIJKLMNOP\n"
+   "0x50: 51 52 53 54 55 56 57 58 59 5A 61 62 63 64 65 66  QRSTUVWXYZabcdef\n"
+)
+string(CONCAT expected ${expected})
+
+execute_process(
+   COMMAND "${SHP_DUMP}" -f "4A 4B" -C 1 "${input}"
+   OUTPUT_VARIABLE output
+   RESULT_VARIABLE result
+)
+
+file(REMOVE "${input}")
+
+if(NOT result EQUAL 0 OR NOT output STREQUAL expected)
+   message(FATAL_ERROR "Unexpected search output (${result}):\n${output}\nExpected:\n${expected}")
+endif()
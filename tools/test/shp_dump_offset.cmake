@@ -0,0 +1,44 @@
+# Check the shp-dump offsets with -s/--offset, both for a file and for the standard input.
+#
+# Usage: cmake -DSHP_DUMP=<path-to-shp-dump> -DWORK_DIR=<directory> -P shp_dump_offset.cmake
+
+if(NOT SHP_DUMP OR NOT WORK_DIR)
+   message(FATAL_ERROR "SHP_DUMP and WORK_DIR should be set")
+endif()
+
+set(input "${WORK_DIR}/shp_dump_offset.bin")
+file(WRITE "${input}"
+   "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/"
+   "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/"
+)
+
+# Row offsets are absolute positions in the input, like in xxd
+set(expected
+   "0x24: 6B 6C 6D 6E 6F 70 71 72 73 74 75 76 77 78 79 7A  klmnopqrstuvwxyz\n"
+   "0x34: 30 31 32 33 34 35 36 37 38 39 2B 2F 41 42 43 44  0123456789+/ABCD\n"
+   "0x44: 45 46 47 48 49 4A 4B 4C                          EFGHIJKL\n"
+)
+string(CONCAT expected ${expected})
+
+execute_process(
+   COMMAND "${SHP_DUMP}" -s 0x24 -l 40 "${input}"
+   OUTPUT_VARIABLE file_output
+   RESULT_VARIABLE file_result
+)
+
+execute_process(
+   COMMAND "${SHP_DUMP}" -s 0x24 -l 40
+   INPUT_FILE "${input}"
+   OUTPUT_VARIABLE stdin_output
+   RESULT_VARIABLE stdin_result
+)
+
+file(REMOVE "${input}")
+
+if(NOT file_result EQUAL 0 OR NOT file_output STREQUAL expected)
+   message(FATAL_ERROR "Unexpected file dump (${file_result}):\n${file_output}\nExpected:\n${expected}")
+endif()
+
+if(NOT stdin_result EQUAL 0 OR NOT stdin_output STREQUAL expected)
+   message(FATAL_ERROR "Unexpected stdin dump (${stdin_result}):\n${stdin_output}\nExpected:\n${expected}")
+endif()
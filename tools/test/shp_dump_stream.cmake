@@ -0,0 +1,72 @@
+# Check that shp-dump prints an input, larger than a single 1 MiB chunk, the same way from a file and from the standard
+# input.
+#
+# Usage: cmake -DSHP_DUMP=<path-to-shp-dump> -DWORK_DIR=<directory> -P shp_dump_stream.cmake
+
+if(NOT SHP_DUMP OR NOT WORK_DIR)
+   message(FATAL_ERROR "SHP_DUMP and WORK_DIR should be set")
+endif()
+
+# 64 bytes doubled 15 times - 2 MiB
+set(content "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/")
+foreach(i RANGE 1 15)
+   string(APPEND content "${content}")
+endforeach()
+
+set(input "${WORK_DIR}/shp_dump_stream.bin")
+file(WRITE "${input}" "${content}")
+
+# Whole input, a window with -l and a window, crossing a chunk boundary in the middle of a row
+set(cases "-w 16" "-s 0x10 -l 0x180000" "-s 0xFFFF5 -l 0x40")
+foreach(name IN LISTS cases)
+   separate_arguments(args UNIX_COMMAND "${name}")
+
+   execute_process(
+      COMMAND "${SHP_DUMP}" ${args} "${input}"
+      OUTPUT_VARIABLE file_output
+      RESULT_VARIABLE file_result
+   )
+
+   execute_process(
+      COMMAND "${SHP_DUMP}" ${args}
+      INPUT_FILE "${input}"
+      OUTPUT_VARIABLE stdin_output
+      RESULT_VARIABLE stdin_result
+   )
+
+   if(NOT file_result EQUAL 0 OR NOT stdin_result EQUAL 0)
+      file(REMOVE "${input}")
+      message(FATAL_ERROR "shp-dump ${name} failed: ${file_result}, ${stdin_result}")
+   endif()
+
+   if(NOT file_output STREQUAL stdin_output)
+      file(REMOVE "${input}")
+      string(SUBSTRING "${file_output}" 0 80 file_start)
+      string(SUBSTRING "${stdin_output}" 0 80 stdin_start)
+      message(FATAL_ERROR "shp-dump ${name} differs for a file and the standard input:\n${file_start}\n${stdin_start}")
+   endif()
+
+   list(APPEND outputs "${file_output}")
+endforeach()
+
+file(REMOVE "${input}")
+
+# Windows larger than a chunk have a fixed offset width: 64 bits without -l, the window end otherwise
+list(GET outputs 0 whole)
+string(SUBSTRING "${whole}" 0 19 first_offset)
+if(NOT first_offset STREQUAL "0x0000000000000000:")
+   message(FATAL_ERROR "Unexpected offset of a whole input: ${first_offset}")
+endif()
+
+list(GET outputs 1 window)
+string(SUBSTRING "${window}" 0 9 first_offset)
+if(NOT first_offset STREQUAL "0x000010:")
+   message(FATAL_ERROR "Unexpected offset of a window: ${first_offset}")
+endif()
+
+# Smaller windows are printed like the library does
+list(GET outputs 2 small)
+string(SUBSTRING "${small}" 0 9 first_offset)
+if(NOT first_offset STREQUAL "0x0FFFF5:")
+   message(FATAL_ERROR "Unexpected offset of a small window: ${first_offset}")
+endif()